@@ -9,6 +9,7 @@
  */
 
 #include <hitech.h>
+#include <graphics.h>
 
 /*
  * Bitmap memory location.
@@ -69,3 +70,18 @@ void (*drawLineH)(ushort, ushort, ushort, uchar);
  * Draw vertical line.
  */
 void (*drawLineV)(ushort, ushort, ushort, uchar);
+
+/*
+ * Draw line that is not horizontal or vertical.
+ */
+void (*drawLineD)(int, int, int, int, uchar);
+
+/*
+ * Draw software sprite.
+ */
+void (*drawBob)(bmpBob *, ushort, ushort);
+
+/*
+ * Erase software sprite.
+ */
+void (*eraseBob)(bmpBob *);
@@ -4,6 +4,24 @@
  * Copyright (c) Steven P. Goldsmith. All rights reserved.
  */
 
+#define bobMaxW 79 /* BOB maximum width in bytes, so shifted width fits 80 */
+
+/*
+ * Software sprite (BOB) with 8 pre-shifted images, 8 pre-shifted masks and
+ * save under buffer. clipW and clipH are the bytes and lines last drawn.
+ */
+typedef struct {
+    uchar w;
+    uchar h;
+    uchar *img;
+    uchar *save;
+    ushort x;
+    ushort y;
+    uchar clipW;
+    uchar clipH;
+    uchar drawn;
+} bmpBob;
+
 extern uchar *bmpMem;
 extern ushort bmpSize;
 extern uchar *bmpColMem;
@@ -16,6 +34,9 @@ extern void (*clearBmp)(uchar);
 extern void (*clearBmpCol)(uchar);
 extern void (*drawLineH)(ushort, ushort, ushort, uchar);
 extern void (*drawLineV)(ushort, ushort, ushort, uchar);
+extern void (*drawLineD)(int, int, int, int, uchar);
+extern void (*drawBob)(bmpBob *, ushort, ushort);
+extern void (*eraseBob)(bmpBob *);
 extern void drawLine(int x0, int y0, int x1, int y1, uchar setPix);
 extern void drawBezier(int x0, int y0, int x1, int y1, int x2, int y2, uchar setPix);
 extern void drawOctant(int xc, int yc, int x, int y, uchar setPix);
@@ -23,3 +44,10 @@ extern void drawEllipse(int xc, int yc, int a, int b, uchar setPix);
 extern void drawCircle(int xc, int yc, int a, uchar setPix);
 extern void drawRect(int x0, int y0, int x1, int y1, uchar setPix);
 extern void drawSquare(int x, int y, int len, uchar setPix);
+extern void shiftBob(uchar *src, uchar *dest, uchar w, uchar h, uchar shift);
+extern uchar initBob(bmpBob *bob, uchar *img, uchar *mask, uchar w, uchar h);
+extern void freeBob(bmpBob *bob);
+extern void drawVicBob(bmpBob *bob, ushort x, ushort y);
+extern void eraseVicBob(bmpBob *bob);
+extern void drawVdcBob(bmpBob *bob, ushort x, ushort y);
+extern void eraseVdcBob(bmpBob *bob);
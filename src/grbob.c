@@ -0,0 +1,64 @@
+/*
+ * Software sprite (BOB) functions.
+ *
+ * Images are shifted 0-7 pixels when the BOB is created, so drawing only masks
+ * whole bytes. Each chip draws and saves the background under the BOB using its
+ * own bitmap layout.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <stdlib.h>
+#include <hitech.h>
+#include <graphics.h>
+
+/*
+ * Shift w byte image lines right shift bits into w + 1 byte lines.
+ */
+void shiftBob(uchar *src, uchar *dest, uchar w, uchar h, uchar shift) {
+    uchar x, y, carry, c;
+    for (y = 0; y < h; y++) {
+        carry = 0;
+        for (x = 0; x < w; x++) {
+            c = *src++;
+            *dest++ = (c >> shift) | carry;
+            carry = (uchar) (c << (8 - shift));
+        }
+        *dest++ = carry;
+    }
+}
+
+/*
+ * Create BOB from w byte (1 to bobMaxW) wide by h line image and mask. Mask
+ * bits are 1 where the image is drawn. Returns 0 if w or h is out of range or
+ * there is not enough memory.
+ */
+uchar initBob(bmpBob *bob, uchar *img, uchar *mask, uchar w, uchar h) {
+    ushort size = (w + 1) * h;
+    uchar i;
+    bob->img = 0;
+    /* 8 images, 8 masks and save under must fit in 64K */
+    if (w == 0 || w > bobMaxW || h == 0 || (ulong) size * 17 > 0xffff) {
+        return 0;
+    }
+    bob->w = w + 1;
+    bob->h = h;
+    bob->drawn = 0;
+    bob->img = (uchar *) malloc(size * 17);
+    if (bob->img == 0) {
+        return 0;
+    }
+    bob->save = bob->img + (size << 4);
+    for (i = 0; i < 8; i++) {
+        shiftBob(img, bob->img + (i * size), w, h, i);
+        shiftBob(mask, bob->img + ((i + 8) * size), w, h, i);
+    }
+    return 1;
+}
+
+/*
+ * Free BOB memory.
+ */
+void freeBob(bmpBob *bob) {
+    free(bob->img);
+}
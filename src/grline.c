@@ -29,6 +29,9 @@ void drawLine(int x0, int y0, int x1, int y1, uchar setPix) {
         } else {
             (*drawLineV)(x1, y1, dy + 1, setPix);
         }
+        /* Device line */
+    } else if (drawLineD != NULL) {
+        (*drawLineD)(x0, y0, x1, y1, setPix);
     } else {
         /* Bresenham line */
         for (;;) {
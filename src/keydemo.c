@@ -146,6 +146,8 @@ main() {
     uchar border = inp(vicBorderCol);
     uchar background = inp(vicBgCol0);
     scrSize = vicScrSize;
+    scrWidth = vicScrCols;
+    scrHeight = vicScrLines;
     scrMem = scr;
     scrColMem = (uchar *) vicColMem;
     chrMem = chr;
@@ -155,6 +157,7 @@ main() {
     /* Use VIC print functions */
     print = printVic;
     printCol = printVicCol;
+    scrollRect = scrollVicRect;
     init(scr, chr);
     run(scr, chr, vicMem);
     free(vicMem);
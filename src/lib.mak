@@ -7,10 +7,29 @@ graphics.obj \
 grline.obj \
 grellip.obj \
 grbezier.obj \
+grbob.obj \
 vic.obj \
 vicscr.obj \
+vicxchr.obj \
+vicscrl.obj \
+vicpage.obj \
+vicras.obj \
 vicbmp.obj \
+vicbob.obj \
+vicmcm.obj \
 vicspr.obj \
+vicsheet.obj \
+vicshspr.obj \
+vicmux.obj \
+viccoll.obj \
+vicasm.obj \
 vdc.obj \
+vdcque.obj \
+vdcmem.obj \
 vdcscr.obj \
-vdcbmp.obj
+vdcshscr.obj \
+vdcvscr.obj \
+vdcbmp.obj \
+vdcbob.obj \
+vdcilace.obj \
+vdcshbmp.obj
@@ -1,4 +1,4 @@
--c -o -x -i0:b: \
+-c -o -x -DVICASM -i0:b: \
 rtc.c \
 sid.c \
 cia.c \
@@ -7,10 +7,29 @@ graphics.c \
 grline.c \
 grellip.c \
 grbezier.c \
+grbob.c \
 vic.c \
 vicscr.c \
+vicxchr.c \
+vicscrl.c \
+vicpage.c \
+vicras.c \
 vicbmp.c \
+vicbob.c \
+vicmcm.c \
 vicspr.c \
+vicsheet.c \
+vicshspr.c \
+vicmux.c \
+viccoll.c \
+vicasm.as \
 vdc.c \
+vdcque.c \
+vdcmem.c \
 vdcscr.c \
-vdcbmp.c
+vdcshscr.c \
+vdcvscr.c \
+vdcbmp.c \
+vdcbob.c \
+vdcilace.c \
+vdcshbmp.c
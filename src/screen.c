@@ -22,6 +22,16 @@ uchar *scrMem;
  */
 ushort scrSize;
 
+/*
+ * Screen width in characters.
+ */
+uchar scrWidth;
+
+/*
+ * Screen height in characters.
+ */
+uchar scrHeight;
+
 /*
  * Screen color location.
  */
@@ -52,6 +62,11 @@ void (*print)(uchar, uchar, char *);
  */
 void (*printCol)(uchar, uchar, uchar, char *);
 
+/*
+ * Scroll rectangle one character in any direction.
+ */
+void (*scrollRect)(uchar, uchar, uchar, uchar, uchar, uchar, uchar);
+
 /*
  * Convert string to from ASCII to PETSCII.
  */
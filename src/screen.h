@@ -6,11 +6,22 @@
 
 extern uchar *scrMem;
 extern ushort scrSize;
+extern uchar scrWidth;
+extern uchar scrHeight;
 extern uchar *scrColMem;
 extern uchar *chrMem;
+
+#define scrUp    0    /* Scroll directions */
+#define scrDown  1
+#define scrLeft  2
+#define scrRight 3
+#define scrCol   0x10 /* Scroll color memory too */
+#define scrFill  0x20 /* Fill vacated line or column */
+
 extern void (*clearScr)( uchar);
 extern void (*clearCol)( uchar);
 extern void (*print)( uchar, uchar, char *);
 extern void (*printCol)( uchar, uchar, uchar, char *);
+extern void (*scrollRect)( uchar, uchar, uchar, uchar, uchar, uchar, uchar);
 extern char *asciiToPet(char *str);
 
@@ -58,16 +58,50 @@ void outVdc(uchar regNum, uchar regVal) {
     outp(vdcDataReg, regVal);
 }
 
+/*
+ * Set VDC update address.
+ */
+void setVdcUpdAddr(ushort vdcMem) {
+    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
+    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+}
+
+/*
+ * Stream memory to VDC memory. The update address is set and the data register
+ * is selected once, then each byte is written as the VDC auto increments.
+ */
+void writeVdcMem(ushort vdcMem, uchar *mem, ushort len) {
+    setVdcUpdAddr(vdcMem);
+    outp(vdcStatusReg, vdcCPUData);
+    while (len-- > 0) {
+        while ((inp(vdcStatusReg) & 0x80) == 0x00)
+            ;
+        outp(vdcDataReg, *mem++);
+    }
+}
+
+/*
+ * Stream VDC memory to memory. The update address is set and the data register
+ * is selected once, then each byte is read as the VDC auto increments.
+ */
+void readVdcMem(ushort vdcMem, uchar *mem, ushort len) {
+    setVdcUpdAddr(vdcMem);
+    outp(vdcStatusReg, vdcCPUData);
+    while (len-- > 0) {
+        while ((inp(vdcStatusReg) & 0x80) == 0x00)
+            ;
+        *mem++ = inp(vdcDataReg);
+    }
+}
+
 /*
  * Or VDC byte with value and store it.
  */
 void orVdcByte(ushort vdcMem, uchar value) {
     uchar saveByte;
-    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+    setVdcUpdAddr(vdcMem);
     saveByte = inVdc(vdcCPUData);
-    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+    setVdcUpdAddr(vdcMem);
     outVdc(vdcCPUData, saveByte | value);
 }
 
@@ -76,11 +110,9 @@ void orVdcByte(ushort vdcMem, uchar value) {
  */
 void andVdcByte(ushort vdcMem, uchar value) {
     uchar saveByte;
-    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+    setVdcUpdAddr(vdcMem);
     saveByte = inVdc(vdcCPUData);
-    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+    setVdcUpdAddr(vdcMem);
     outVdc(vdcCPUData, saveByte & value);
 }
 
@@ -90,8 +122,7 @@ void andVdcByte(ushort vdcMem, uchar value) {
 void fillVdcMem(ushort vdcMem, ushort len, uchar value) {
     uchar blocks, remain;
     register uchar i;
-    outVdc(vdcUpdAddrHi, (uchar) (vdcMem >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) vdcMem);
+    setVdcUpdAddr(vdcMem);
     outVdc(vdcVtSmScroll, (inVdc(vdcVtSmScroll) & 0x7f));
     outVdc(vdcCPUData, value);
     if (len > vdcMaxBlock) {
@@ -106,41 +137,113 @@ void fillVdcMem(ushort vdcMem, ushort len, uchar value) {
 }
 
 /*
- * Copy VDC character set to memory.
+ * Fast copy using block copy. Source and destination can overlap as long as
+ * destination is below source since the VDC copies in ascending order.
  */
-void copyVdcChrMem(uchar *mem, ushort vdcMem, ushort chars) {
+void copyVdcMem(ushort srcMem, ushort destMem, ushort len) {
+    ushort blocks, i;
+    uchar remain;
+    setVdcUpdAddr(destMem);
+    outVdc(vdcVtSmScroll, (inVdc(vdcVtSmScroll) | 0x80));
+    outVdc(vdcBlkCpySrcAddrHi, (uchar) (srcMem >> 8));
+    outVdc(vdcBlkCpySrcAddrLo, (uchar) srcMem);
+    blocks = len / vdcMaxBlock;
+    remain = len % vdcMaxBlock;
+    /* Update and source address continue where last block left off */
+    for (i = 0; i < blocks; i++)
+        outVdc(vdcWordCnt, vdcMaxBlock);
+    if (remain > 0)
+        outVdc(vdcWordCnt, remain);
+}
+
+/*
+ * Read chrBytes of each VDC character definition to memory. Definitions are 16
+ * bytes apart (32 if chrBytes is over 16), so full definitions are streamed in
+ * one pass and partial ones set the update address once per character.
+ */
+void readVdcChr(uchar *mem, ushort vdcMem, ushort chars, uchar chrBytes) {
+    uchar chrSize = chrBytes > 16 ? vdcMaxCharBytes : 16;
     register uchar c;
-    ushort vdcOfs = vdcMem, memOfs = 0, i;
-    for (i = 0; i < chars; i++) {
-        outVdc(vdcUpdAddrHi, (uchar) (vdcOfs >> 8));
-        outVdc(vdcUpdAddrLo, (uchar) vdcOfs);
-        /* Only use 8 bytes of 16 byte character definition */
-        for (c = 0; c < 8; c++) {
-            mem[memOfs + c] = inVdc(vdcCPUData);
+    ushort i;
+    if (chrBytes == chrSize) {
+        readVdcMem(vdcMem, mem, chars * chrSize);
+    } else {
+        for (i = 0; i < chars; i++) {
+            setVdcUpdAddr(vdcMem);
+            outp(vdcStatusReg, vdcCPUData);
+            for (c = 0; c < chrBytes; c++) {
+                while ((inp(vdcStatusReg) & 0x80) == 0x00)
+                    ;
+                *mem++ = inp(vdcDataReg);
+            }
+            vdcMem += chrSize;
         }
-        memOfs += 8;
-        vdcOfs += 16;
     }
 }
 
 /*
- * Copy character set to VDC memory.
+ * Write chrBytes per character from memory to VDC character definitions with
+ * one address setup. Character data is streamed and the rest of each 16 (or 32)
+ * byte definition is cleared with a block fill. style is 0 or any of
+ * vdcChrBold, vdcChrUline and vdcChrRvs to generate a variant, for instance
+ * into the alternate character set.
  */
-void copyVdcMemChr(uchar *mem, ushort vdcMem, ushort chars) {
+void writeVdcChr(uchar *mem, ushort vdcMem, ushort chars, uchar chrBytes,
+        uchar style) {
+    uchar chrSize = chrBytes > 16 ? vdcMaxCharBytes : 16;
+    uchar last = chrBytes - 1;
+    uchar chr[vdcMaxCharBytes];
     register uchar c;
-    ushort vdcOfs = vdcMem, memOfs = 0, i;
+    uchar b;
+    ushort i;
+    /* Padding uses block fill */
+    outVdc(vdcVtSmScroll, (inVdc(vdcVtSmScroll) & 0x7f));
+    setVdcUpdAddr(vdcMem);
     for (i = 0; i < chars; i++) {
-        outVdc(vdcUpdAddrHi, (uchar) (vdcOfs >> 8));
-        outVdc(vdcUpdAddrLo, (uchar) vdcOfs);
-        /* Only use 8 bytes of 16 byte character definition */
-        for (c = 0; c < 8; c++) {
-            outVdc(vdcCPUData, mem[memOfs + c]);
+        for (c = 0; c < chrBytes; c++) {
+            b = *mem++;
+            if (style & vdcChrBold) {
+                b |= b >> 1;
+            }
+            if ((style & vdcChrUline) && (c == last)) {
+                b = 0xff;
+            }
+            if (style & vdcChrRvs) {
+                b = ~b;
+            }
+            chr[c] = b;
+        }
+        outp(vdcStatusReg, vdcCPUData);
+        for (c = 0; c < chrBytes; c++) {
+            while ((inp(vdcStatusReg) & 0x80) == 0x00)
+                ;
+            outp(vdcDataReg, chr[c]);
+        }
+        if (chrBytes < chrSize) {
+            outVdc(vdcCPUData, 0x00);
+            if (chrSize - chrBytes > 1) {
+                outVdc(vdcWordCnt, chrSize - chrBytes - 1);
+            }
         }
-        memOfs += 8;
-        vdcOfs += 16;
     }
 }
 
+/*
+ * Copy VDC character set to memory.
+ */
+void copyVdcChrMem(uchar *mem, ushort vdcMem, ushort chars) {
+    /* Only use 8 bytes of 16 byte character definition */
+    readVdcChr(mem, vdcMem, chars, 8);
+}
+
+/*
+ * Copy character set to VDC memory.
+ */
+void copyVdcMemChr(uchar *mem, ushort vdcMem, ushort chars) {
+    /* Only use 8 bytes of 16 byte character definition */
+    writeVdcChr(mem, vdcMem, chars, 8, 0);
+}
+
 /*
  * Set bitmap memory location, attribute memory location and bitmap mode.
  */
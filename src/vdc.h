@@ -80,33 +80,100 @@
 #define vdcCharsPerSet   256
 #define vdcMaxCharBytes  32
 
+#define vdcChrBold  0x01       /* VDC generated character styles */
+#define vdcChrUline 0x02
+#define vdcChrRvs   0x04
+
+#define vdcQueSize 8      /* VDC operation queue size (power of 2) */
+#define vdcQueFill 0      /* VDC queued operations */
+#define vdcQueCopy 1
+
+#define vdcMemNone 0xffff /* VDC allocation failed */
+
+#define vdcTxt80x25    0  /* VDC text modes (NTSC) */
+#define vdcTxt80x30    1
+#define vdcTxt80x50    2
+#define vdcTxt80x25x16 3
+#define vdcTxtModeRegs 14
+
 #define vdcScrMem 0x0000  /* VDC default screen memory */
 #define vdcColMem 0x0800  /* VDC default attribute memory */
 #define vdcChrMem 0x2000  /* VDC default character set memory */
 #define vdcScrSize 2000   /* VDC screen size in bytes */
+#define vdcScrCols 80     /* VDC screen size in columns */
+#define vdcScrLines 25    /* VDC screen size in lines */
+#define vdcMaxScrLines 50 /* VDC maximum screen lines */
 #define vdcBmpSize 16000  /* VDC bitmap size in bytes */
 
 #define vdcBmpSize 16000      /* 640x200 screen size in bytes */
+#define vdcBmpLines 200       /* 640x200 scan lines */
 #define vdcOddFldOfs 21360    /* 640 X 480 interlace odd field offset */
+#define vdcIlaceFldSize 19200 /* 640 X 480 interlace field size in bytes */
 
 extern void saveVdc();
 extern void restoreVdc();
 extern uchar inVdc(uchar regNum);
 extern void outVdc(uchar regNum, uchar regVal);
 extern void setVdcDspPage(ushort dispPage, ushort attrPage);
+extern uchar getVdcMemSize();
+extern void setVdcMemSize(uchar size);
+extern void initVdcMem(ushort start);
+extern ushort allocVdcMem(ushort len, ushort align);
+extern void waitVdcVBlank();
+extern void setVdcBackPage();
+extern void setVdcPages(ushort scr0, ushort attr0, ushort scr1, ushort attr1);
+extern void flipVdcPage();
 extern void setVdcFgBg(uchar f, uchar b);
 extern void setVdcAttrsOn();
 extern void setVdcAttrsOff();
 extern void setVdcCursor(uchar top, uchar bottom, uchar mode);
+extern void setVdcUpdAddr(ushort vdcMem);
+extern void writeVdcMem(ushort vdcMem, uchar *mem, ushort len);
+extern void readVdcMem(ushort vdcMem, uchar *mem, ushort len);
 extern void orVdcByte(ushort vdcMem, uchar value);
 extern void andVdcByte(ushort vdcMem, uchar value);
 extern void fillVdcMem(ushort vdcMem, ushort len, uchar value);
+extern void copyVdcMem(ushort srcMem, ushort destMem, ushort len);
+extern void readVdcChr(uchar *mem, ushort vdcMem, ushort chars,
+        uchar chrBytes);
+extern void writeVdcChr(uchar *mem, ushort vdcMem, ushort chars,
+        uchar chrBytes, uchar style);
 extern void copyVdcChrMem(uchar *mem, ushort vdcMem, ushort chars);
 extern void copyVdcMemChr(uchar *mem, ushort vdcMem, ushort chars);
+extern void queVdcFill(ushort vdcMem, ushort len, uchar value);
+extern void queVdcCopy(ushort srcMem, ushort destMem, ushort len);
+extern uchar pollVdcQue();
+extern void waitVdcQue();
+extern void setVdcTxtMode(uchar mode);
 extern void clearVdcScr(uchar c);
 extern void clearVdcCol(uchar c);
 extern void printVdc(uchar x, uchar y, char *str);
 extern void printVdcCol(uchar x, uchar y, uchar color, char *str);
+extern void scrollVdcUpX(ushort vdcMem, uchar x, uchar y, uchar len,
+        uchar lines);
+extern void scrollVdcUp(ushort vdcMem, uchar y, uchar lines);
+extern void scrollVdcDownX(ushort vdcMem, uchar x, uchar y, uchar len,
+        uchar lines);
+extern void scrollVdcDown(ushort vdcMem, uchar y, uchar lines);
+extern void moveVdcMemRight(ushort vdcMem, uchar len);
+extern void scrollVdcRect(uchar x, uchar y, uchar w, uchar h, uchar dir,
+        uchar c, uchar color);
+extern uchar vdcVirtCols, vdcVirtRows;
+extern ushort vdcVirtScr, vdcVirtCol;
+extern void setVdcVirtScr(ushort scr, ushort attr, uchar cols, uchar rows);
+extern void panVdcVirtScr(ushort x, ushort y);
+extern void printVdcVirt(uchar x, uchar y, char *str);
+extern void printVdcVirtCol(uchar x, uchar y, uchar color, char *str);
+extern uchar *vdcShScr, *vdcShCol;
+extern void setVdcShScr(uchar *scr, uchar *col);
+extern void putVdcShMem(uchar *mem, uchar *first, uchar *last, uchar x,
+        uchar y, char *str, uchar value, ushort len);
+extern void syncVdcShMem(uchar *mem, uchar *first, uchar *last, ushort vdcMem);
+extern void syncVdcShScr();
+extern void clearVdcShScr(uchar c);
+extern void clearVdcShCol(uchar c);
+extern void printVdcSh(uchar x, uchar y, char *str);
+extern void printVdcShCol(uchar x, uchar y, uchar color, char *str);
 extern void setVdcBmpMode(ushort dispPage, ushort attrPage);
 extern void clearVdcBmp(uchar c);
 extern void clearVdcBmpCol(uchar c);
@@ -117,3 +184,31 @@ extern void drawVdcLineH(ushort x, ushort y, ushort len,
 extern void drawVdcLineV(ushort x, ushort y, ushort len,
         uchar setPix);
 extern void printVdcBmp(uchar x, uchar y, char *str);
+extern uchar vdcCellHeight;
+extern void setVdcColBmpMode(ushort dispPage, ushort attrPage,
+        uchar cellHeight);
+extern void fillVdcColRect(uchar x, uchar y, uchar w, uchar h, uchar color);
+extern void printVdcColBmp(uchar x, uchar y, uchar color, char *str);
+extern void setVdcIlaceBmpMode(ushort dispPage, ushort attrPage);
+extern void clearVdcIlaceBmp(uchar c);
+extern void setVdcIlacePix(ushort x, ushort y);
+extern void clearVdcIlacePix(ushort x, ushort y);
+extern void drawVdcIlaceLineH(ushort x, ushort y, ushort len,
+        uchar setPix);
+extern void drawVdcIlaceLineV(ushort x, ushort y, ushort len,
+        uchar setPix);
+extern void printVdcIlaceBmp(uchar x, uchar y, char *str);
+extern uchar vdcBitTable[];
+extern uchar *vdcShMem;
+extern void cleanVdcShBmp();
+extern void setVdcShBmp(uchar *mem);
+extern void markVdcShBmp(ushort y, uchar first, uchar last);
+extern void flushVdcShBmp();
+extern void clearVdcShBmp(uchar c);
+extern void setVdcShPix(ushort x, ushort y);
+extern void clearVdcShPix(ushort x, ushort y);
+extern void drawVdcShLineH(ushort x, ushort y, ushort len,
+        uchar setPix);
+extern void drawVdcShLineV(ushort x, ushort y, ushort len,
+        uchar setPix);
+extern void printVdcShBmp(uchar x, uchar y, char *str);
@@ -15,11 +15,6 @@
  */
 uchar vdcBitTable[8] = { 128, 64, 32, 16, 8, 4, 2, 1 };
 
-/*
- * Lookup for fast horizontal pixel fill.
- */
-uchar vdcFillTable[7] = { 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 };
-
 /*
  * Clear screen.
  */
@@ -42,11 +37,9 @@ void setVdcPix(ushort x, ushort y) {
     uchar saveByte;
     ushort pixByte;
     pixByte = vdcMem + (y << 6) + (y << 4) + (x >> 3);
-    outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) pixByte);
+    setVdcUpdAddr(pixByte);
     saveByte = inVdc(vdcCPUData);
-    outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) pixByte);
+    setVdcUpdAddr(pixByte);
     outVdc(vdcCPUData, saveByte | vdcBitTable[x & 0x07]);
 }
 
@@ -58,52 +51,54 @@ void clearVdcPix(ushort x, ushort y) {
     uchar saveByte;
     ushort pixByte;
     pixByte = vdcMem + (y << 6) + (y << 4) + (x >> 3);
-    outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) pixByte);
+    setVdcUpdAddr(pixByte);
     saveByte = inVdc(vdcCPUData);
-    outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) pixByte);
+    setVdcUpdAddr(pixByte);
     outVdc(vdcCPUData, saveByte & ~vdcBitTable[x & 0x07]);
 }
 
 /*
- * Optimized horizontal line algorithm up to 40x faster than Bresenham.
+ * Optimized horizontal line algorithm up to 40x faster than Bresenham. First
+ * and last bytes are masked and bytes between are filled using block fill.
  */
 void drawVdcLineH(ushort x, ushort y, ushort len, uchar setPix) {
-    ushort vdcMem = (ushort) bmpMem;
-    ushort pixByte = vdcMem + (y << 6) + (y << 4) + (x >> 3);
-    uchar firstBits = x % 8;
-    uchar lastBits = (x + len - 1) % 8;
-    ushort fillBytes = (len - lastBits - 1) >> 3;
-    ushort i;
-    static uchar fillTable[7] = { 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01 };
-    if (firstBits > 0) {
-        /* Handle left over bits on first byte */
-        if (setPix) {
-            orVdcByte(pixByte, fillTable[firstBits - 1]);
+    ushort pixByte = (ushort) bmpMem + (y << 6) + (y << 4) + (x >> 3);
+    uchar firstCol = x >> 3;
+    uchar lastCol = (x + len - 1) >> 3;
+    uchar firstMask = 0xff >> (x & 0x07);
+    uchar lastMask = ~(0x7f >> ((x + len - 1) & 0x07));
+    if (len > 0) {
+        if (firstCol == lastCol) {
+            /* Line starts and ends in same byte */
+            firstMask &= lastMask;
+            if (setPix) {
+                orVdcByte(pixByte, firstMask);
+            } else {
+                andVdcByte(pixByte, ~firstMask);
+            }
         } else {
-            andVdcByte(pixByte, ~fillTable[firstBits - 1]);
-        }
-        pixByte += 1;
-    } else {
-        outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-        outVdc(vdcUpdAddrLo, (uchar) pixByte);
-    }
-    /* Fill in bytes */
-    for (i = 0; i < fillBytes; i++) {
-        if (setPix) {
-            outVdc(vdcCPUData, 0xff);
-        } else {
-            outVdc(vdcCPUData, 0x00);
-        }
-    }
-    pixByte += fillBytes;
-    /* Handle left over bits on last byte */
-    if (lastBits > 0) {
-        if (setPix) {
-            orVdcByte(pixByte, ~fillTable[lastBits - 1]);
-        } else {
-            andVdcByte(pixByte, fillTable[lastBits - 1]);
+            /* Handle bits on first byte */
+            if (setPix) {
+                orVdcByte(pixByte, firstMask);
+            } else {
+                andVdcByte(pixByte, ~firstMask);
+            }
+            pixByte += 1;
+            /* Fill in bytes using block fill */
+            if (lastCol > firstCol + 1) {
+                if (setPix) {
+                    fillVdcMem(pixByte, lastCol - firstCol - 1, 0xff);
+                } else {
+                    fillVdcMem(pixByte, lastCol - firstCol - 1, 0x00);
+                }
+                pixByte += lastCol - firstCol - 1;
+            }
+            /* Handle bits on last byte */
+            if (setPix) {
+                orVdcByte(pixByte, lastMask);
+            } else {
+                andVdcByte(pixByte, ~lastMask);
+            }
         }
     }
 }
@@ -119,18 +114,14 @@ void drawVdcLineV(ushort x, ushort y, ushort len, uchar setPix) {
     /* Plot pixels */
     for (i = 0; i < len; i++) {
         if (setPix) {
-            outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-            outVdc(vdcUpdAddrLo, (uchar) pixByte);
+            setVdcUpdAddr(pixByte);
             saveByte = inVdc(vdcCPUData);
-            outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-            outVdc(vdcUpdAddrLo, (uchar) pixByte);
+            setVdcUpdAddr(pixByte);
             outVdc(vdcCPUData, saveByte | vBit);
         } else {
-            outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-            outVdc(vdcUpdAddrLo, (uchar) pixByte);
+            setVdcUpdAddr(pixByte);
             saveByte = inVdc(vdcCPUData);
-            outVdc(vdcUpdAddrHi, (uchar) (pixByte >> 8));
-            outVdc(vdcUpdAddrLo, (uchar) pixByte);
+            setVdcUpdAddr(pixByte);
             outVdc(vdcCPUData, saveByte & ~vBit);
         }
         pixByte += 80;
@@ -138,23 +129,82 @@ void drawVdcLineV(ushort x, ushort y, ushort len, uchar setPix) {
 }
 
 /*
- * Print without color. Optimized by setting VDC address once for each scan line.
+ * Print without color. Each scan line is built in memory and streamed to the
+ * VDC with one address setup. Strings are limited to 80 characters.
  */
 void printVdcBmp(uchar x, uchar y, char *str) {
     ushort vdcMem = (ushort) bmpMem;
     ushort dispOfs = ((y * 80) * 8) + vdcMem + x;
     ushort len = strlen(str);
-    ushort i, chrOfs;
+    ushort i;
     uchar c;
+    uchar scanLine[80];
+    if (len > 80) {
+        len = 80;
+    }
     /* Draw 8 scan lines */
     for (c = 0; c < 8; c++) {
-        outVdc(vdcUpdAddrHi, (uchar) (dispOfs >> 8));
-        outVdc(vdcUpdAddrLo, (uchar) dispOfs);
         for (i = 0; i < len; i++) {
-            chrOfs = (str[i] << 3) + c;
-            outVdc(vdcCPUData, bmpChrMem[chrOfs]);
+            scanLine[i] = bmpChrMem[(str[i] << 3) + c];
         }
+        writeVdcMem(dispOfs, scanLine, len);
         /* Next scan line */
         dispOfs += 80;
     }
 }
+
+/*
+ * Attribute cell height in scan lines for color bitmap mode.
+ */
+uchar vdcCellHeight = 8;
+
+/*
+ * Set color bitmap mode with 8 x cellHeight attribute cells. cellHeight must be
+ * 2, 4 or 8, otherwise nothing is changed. A height of 1 would need more rows
+ * than the 8 bit vertical total register holds. Vertical total, sync and
+ * displayed rows are scaled from the current values, so NTSC and PAL both work.
+ * bmpColSize is set to the attribute memory size.
+ */
+void setVdcColBmpMode(ushort dispPage, ushort attrPage, uchar cellHeight) {
+    uchar rowLines = inVdc(vdcChTotalVt) + 1;
+    ushort totalLines = ((inVdc(vdcVtTotal) + 1) * rowLines)
+            + (inVdc(vdcVtTotalAdj) & 0x1f);
+    ushort syncLine = inVdc(vdcVtSyncPos) * rowLines;
+    if (cellHeight != 2 && cellHeight != 4 && cellHeight != 8) {
+        return;
+    }
+    vdcCellHeight = cellHeight;
+    outVdc(vdcChTotalVt, (inVdc(vdcChTotalVt) & 0xe0) | (cellHeight - 1));
+    outVdc(vdcChDspVt, (inVdc(vdcChDspVt) & 0xe0) | cellHeight);
+    outVdc(vdcVtTotal, (totalLines / cellHeight) - 1);
+    outVdc(vdcVtTotalAdj, totalLines % cellHeight);
+    outVdc(vdcVtDisp, vdcBmpLines / cellHeight);
+    outVdc(vdcVtSyncPos, syncLine / cellHeight);
+    bmpColSize = (vdcBmpLines / cellHeight) * 80;
+    setVdcBmpMode(dispPage, attrPage);
+    setVdcAttrsOn();
+}
+
+/*
+ * Fill rectangle of attribute cells with color (foreground in high nibble and
+ * background in low nibble).
+ */
+void fillVdcColRect(uchar x, uchar y, uchar w, uchar h, uchar color) {
+    ushort colOfs = (ushort) bmpColMem + (y * 80) + x;
+    uchar i;
+    for (i = 0; i < h; i++) {
+        fillVdcMem(colOfs, w, color);
+        colOfs += 80;
+    }
+}
+
+/*
+ * Print with foreground/background color. Every attribute cell the text
+ * touches is colored.
+ */
+void printVdcColBmp(uchar x, uchar y, uchar color, char *str) {
+    uchar firstCell = (y * 8) / vdcCellHeight;
+    uchar lastCell = ((y * 8) + 7) / vdcCellHeight;
+    fillVdcColRect(x, firstCell, strlen(str), lastCell - firstCell + 1, color);
+    printVdcBmp(x, y, str);
+}
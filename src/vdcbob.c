@@ -0,0 +1,68 @@
+/*
+ * C128 8563 VDC software sprite (BOB) functions.
+ *
+ * Each BOB line is read, masked in memory and written back as one stream.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <hitech.h>
+#include <graphics.h>
+#include <vdc.h>
+
+/*
+ * Save background and draw BOB at pixel x, y. BOB is clipped at the right and
+ * bottom of the bitmap and not drawn if x, y is off the bitmap.
+ */
+void drawVdcBob(bmpBob *bob, ushort x, ushort y) {
+    ushort size = bob->w * bob->h;
+    uchar *img = bob->img + ((x & 0x07) * size);
+    uchar *mask = img + (size << 3);
+    uchar *save = bob->save;
+    uchar line[vdcScrCols];
+    ushort vdcMem = (ushort) bmpMem + (y << 6) + (y << 4) + (x >> 3);
+    uchar i, j, skip;
+    bob->drawn = 0;
+    if ((x >> 3) < vdcScrCols && y < vdcBmpLines) {
+        bob->x = x;
+        bob->y = y;
+        bob->clipW = bob->w;
+        bob->clipH = bob->h;
+        if ((x >> 3) + bob->clipW > vdcScrCols) {
+            bob->clipW = vdcScrCols - (x >> 3);
+        }
+        if (y + bob->clipH > vdcBmpLines) {
+            bob->clipH = vdcBmpLines - y;
+        }
+        skip = bob->w - bob->clipW;
+        for (i = 0; i < bob->clipH; i++) {
+            readVdcMem(vdcMem, save, bob->clipW);
+            for (j = 0; j < bob->clipW; j++) {
+                line[j] = (*save++ & ~*mask++) | *img++;
+            }
+            writeVdcMem(vdcMem, line, bob->clipW);
+            img += skip;
+            mask += skip;
+            vdcMem += vdcScrCols;
+        }
+        bob->drawn = 1;
+    }
+}
+
+/*
+ * Restore background under BOB.
+ */
+void eraseVdcBob(bmpBob *bob) {
+    uchar *save = bob->save;
+    ushort vdcMem = (ushort) bmpMem + (bob->y << 6) + (bob->y << 4)
+            + (bob->x >> 3);
+    uchar i;
+    if (bob->drawn) {
+        for (i = 0; i < bob->clipH; i++) {
+            writeVdcMem(vdcMem, save, bob->clipW);
+            save += bob->clipW;
+            vdcMem += vdcScrCols;
+        }
+        bob->drawn = 0;
+    }
+}
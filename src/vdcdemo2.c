@@ -29,6 +29,8 @@ void init() {
     outp(cia1DdrB, 0x00);
     /* Set default sizes and locations */
     scrSize = vdcScrSize;
+    scrWidth = vdcScrCols;
+    scrHeight = vdcScrLines;
     scrMem = (uchar *) vdcScrMem;
     scrColMem = (uchar *) vdcColMem;
     chrMem = (uchar *) vdcChrMem;
@@ -37,6 +39,7 @@ void init() {
     clearCol = clearVdcCol;
     print = printVdc;
     printCol = printVdcCol;
+    scrollRect = scrollVdcRect;
     saveVdc();
     setVdcCursor(0, 0, vdcCurNone);
     clearScr(32);
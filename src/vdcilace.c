@@ -0,0 +1,131 @@
+/*
+ * C128 8563 VDC 640x480 interlace bitmap functions.
+ *
+ * Even scan lines are in the even field at bmpMem and odd scan lines are in the
+ * odd field at bmpMem + vdcOddFldOfs. Each field is a 640x240 bitmap, so the
+ * 640x200 functions are reused with the field selected. 64K VDC memory is
+ * required.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <string.h>
+#include <hitech.h>
+#include <graphics.h>
+#include <vdc.h>
+
+/*
+ * NTSC 640x480 interlace register values.
+ */
+uchar vdcIlaceRegs[] = { vdcVtTotal, 64, vdcVtTotalAdj, 5, vdcVtDisp, 60,
+        vdcVtSyncPos, 62, vdcIlaceMode, 3, vdcChTotalVt, 7 };
+
+/*
+ * Set interlace registers, bitmap memory location, attribute memory location
+ * and bitmap mode.
+ */
+void setVdcIlaceBmpMode(ushort dispPage, ushort attrPage) {
+    uchar i;
+    for (i = 0; i < sizeof(vdcIlaceRegs); i += 2)
+        outVdc(vdcIlaceRegs[i], vdcIlaceRegs[i + 1]);
+    setVdcBmpMode(dispPage, attrPage);
+}
+
+/*
+ * Clear both fields using block fills.
+ */
+void clearVdcIlaceBmp(uchar c) {
+    fillVdcMem((ushort) bmpMem, vdcIlaceFldSize, c);
+    fillVdcMem((ushort) bmpMem + vdcOddFldOfs, vdcIlaceFldSize, c);
+}
+
+/*
+ * Set pixel.
+ */
+void setVdcIlacePix(ushort x, ushort y) {
+    uchar *saveMem = bmpMem;
+    if (y & 1) {
+        bmpMem += vdcOddFldOfs;
+    }
+    setVdcPix(x, y >> 1);
+    bmpMem = saveMem;
+}
+
+/*
+ * Clear pixel.
+ */
+void clearVdcIlacePix(ushort x, ushort y) {
+    uchar *saveMem = bmpMem;
+    if (y & 1) {
+        bmpMem += vdcOddFldOfs;
+    }
+    clearVdcPix(x, y >> 1);
+    bmpMem = saveMem;
+}
+
+/*
+ * Horizontal line lies in one field.
+ */
+void drawVdcIlaceLineH(ushort x, ushort y, ushort len, uchar setPix) {
+    uchar *saveMem = bmpMem;
+    if (y & 1) {
+        bmpMem += vdcOddFldOfs;
+    }
+    drawVdcLineH(x, y >> 1, len, setPix);
+    bmpMem = saveMem;
+}
+
+/*
+ * Vertical line is drawn as one vertical line in each field.
+ */
+void drawVdcIlaceLineV(ushort x, ushort y, ushort len, uchar setPix) {
+    uchar *saveMem = bmpMem;
+    ushort evenY = (y + 1) >> 1, oddY = y >> 1;
+    ushort evenLen, oddLen;
+    /* Split lines between fields */
+    if (y & 1) {
+        oddLen = (len + 1) >> 1;
+        evenLen = len >> 1;
+    } else {
+        evenLen = (len + 1) >> 1;
+        oddLen = len >> 1;
+    }
+    if (evenLen > 0) {
+        drawVdcLineV(x, evenY, evenLen, setPix);
+    }
+    if (oddLen > 0) {
+        bmpMem += vdcOddFldOfs;
+        drawVdcLineV(x, oddY, oddLen, setPix);
+        bmpMem = saveMem;
+    }
+}
+
+/*
+ * Print without color. Even character scan lines go to the even field and odd
+ * character scan lines go to the odd field, thus 60 lines of text fit.
+ * Strings are limited to 80 characters.
+ */
+void printVdcIlaceBmp(uchar x, uchar y, char *str) {
+    ushort dispOfs = (y * 320) + (ushort) bmpMem + x;
+    ushort len = strlen(str);
+    ushort i;
+    uchar c;
+    uchar scanLine[80];
+    if (len > 80) {
+        len = 80;
+    }
+    /* Draw 8 scan lines, 4 in each field */
+    for (c = 0; c < 8; c++) {
+        for (i = 0; i < len; i++) {
+            scanLine[i] = bmpChrMem[(str[i] << 3) + c];
+        }
+        if (c & 1) {
+            writeVdcMem(dispOfs + vdcOddFldOfs, scanLine, len);
+            /* Next scan line in field */
+            dispOfs += 80;
+        } else {
+            writeVdcMem(dispOfs, scanLine, len);
+        }
+    }
+}
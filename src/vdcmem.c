@@ -0,0 +1,142 @@
+/*
+ * C128 8563 VDC memory management and page flipping.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <screen.h>
+#include <graphics.h>
+#include <vdc.h>
+
+/*
+ * Next free VDC address and last VDC address.
+ */
+ushort vdcMemFree, vdcMemLast;
+
+/*
+ * Screen and attribute memory of each page.
+ */
+ushort vdcPageScr[2], vdcPageAttr[2];
+
+/*
+ * Page being displayed.
+ */
+uchar vdcFrontPage;
+
+/*
+ * Detect 16K or 64K VDC memory. Register 28 is restored, so the memory mode is
+ * not changed. Use setVdcMemSize to select 64K mode.
+ */
+uchar getVdcMemSize() {
+    uchar chSet = inVdc(vdcChSetStAddr);
+    uchar save0, save1, test;
+    /* Select 64K memory */
+    outVdc(vdcChSetStAddr, chSet | 0x10);
+    readVdcMem(0x1fff, &save0, 1);
+    readVdcMem(0x9fff, &save1, 1);
+    /* 16K memory wraps, so second write lands on first address */
+    test = 0x00;
+    writeVdcMem(0x1fff, &test, 1);
+    test = 0xff;
+    writeVdcMem(0x9fff, &test, 1);
+    readVdcMem(0x1fff, &test, 1);
+    writeVdcMem(0x9fff, &save1, 1);
+    writeVdcMem(0x1fff, &save0, 1);
+    outVdc(vdcChSetStAddr, chSet);
+    if (test == 0x00) {
+        return 64;
+    }
+    return 16;
+}
+
+/*
+ * Select 16K or 64K memory mode. Screen and character set addresses change
+ * meaning when the mode changes, so set this before setting them.
+ */
+void setVdcMemSize(uchar size) {
+    if (size == 64) {
+        outVdc(vdcChSetStAddr, inVdc(vdcChSetStAddr) | 0x10);
+    } else {
+        outVdc(vdcChSetStAddr, inVdc(vdcChSetStAddr) & 0xef);
+    }
+}
+
+/*
+ * Initialize allocator to use VDC memory from start to end of memory. 64K is
+ * only used if detected and 64K mode is selected.
+ */
+void initVdcMem(ushort start) {
+    vdcMemFree = start;
+    if ((inVdc(vdcChSetStAddr) & 0x10) && getVdcMemSize() == 64) {
+        /* Last byte is not used, so vdcMemFree never wraps to 0 */
+        vdcMemLast = 0xfffe;
+    } else {
+        vdcMemLast = 0x3fff;
+    }
+}
+
+/*
+ * Allocate len bytes of VDC memory aligned to align (power of 2). Use 0x2000
+ * for character sets. Returns vdcMemNone if there is no room.
+ */
+ushort allocVdcMem(ushort len, ushort align) {
+    ushort vdcMem = vdcMemFree;
+    if (align > 1) {
+        vdcMem = (vdcMem + align - 1) & ~(align - 1);
+        /* Wrapped past end of memory? */
+        if (vdcMem < vdcMemFree) {
+            return vdcMemNone;
+        }
+    }
+    if ((len == 0) || (vdcMem > vdcMemLast) || (len - 1 > vdcMemLast - vdcMem)) {
+        return vdcMemNone;
+    }
+    vdcMemFree = vdcMem + len;
+    return vdcMem;
+}
+
+/*
+ * Wait for start of vertical blank.
+ */
+void waitVdcVBlank() {
+    while ((inp(vdcStatusReg) & 0x20) == 0x20)
+        ;
+    while ((inp(vdcStatusReg) & 0x20) == 0x00)
+        ;
+}
+
+/*
+ * Set back page screen and attribute memory as current screen and bitmap.
+ */
+void setVdcBackPage() {
+    uchar back = vdcFrontPage ^ 1;
+    scrMem = (uchar *) vdcPageScr[back];
+    scrColMem = (uchar *) vdcPageAttr[back];
+    bmpMem = (uchar *) vdcPageScr[back];
+    bmpColMem = (uchar *) vdcPageAttr[back];
+}
+
+/*
+ * Configure double buffering. Page 0 is displayed and drawing is done to page 1.
+ */
+void setVdcPages(ushort scr0, ushort attr0, ushort scr1, ushort attr1) {
+    vdcPageScr[0] = scr0;
+    vdcPageAttr[0] = attr0;
+    vdcPageScr[1] = scr1;
+    vdcPageAttr[1] = attr1;
+    vdcFrontPage = 0;
+    setVdcDspPage(scr0, attr0);
+    setVdcBackPage();
+}
+
+/*
+ * Display back page during vertical blank and draw to old front page.
+ */
+void flipVdcPage() {
+    vdcFrontPage ^= 1;
+    waitVdcVBlank();
+    setVdcDspPage(vdcPageScr[vdcFrontPage], vdcPageAttr[vdcFrontPage]);
+    setVdcBackPage();
+}
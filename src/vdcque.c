@@ -0,0 +1,130 @@
+/*
+ * C128 8563 VDC queued block fill and copy.
+ *
+ * Fills and copies are queued and returned from immediately. pollVdcQue is
+ * called from the main loop and only issues the next block when the VDC is
+ * ready, thus the Z80 can do other work while the VDC moves memory.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <vdc.h>
+
+/*
+ * Queued operation.
+ */
+typedef struct {
+    uchar op;
+    ushort srcMem;
+    ushort destMem;
+    ushort len;
+    uchar value;
+} vdcQueEntry;
+
+/*
+ * Operation queue.
+ */
+vdcQueEntry vdcQue[vdcQueSize];
+
+/*
+ * Queue head, tail and count.
+ */
+uchar vdcQueHead = 0, vdcQueTail = 0, vdcQueCount = 0;
+
+/*
+ * Get next free queue entry. Polls until a slot frees up if queue is full.
+ */
+vdcQueEntry *nextVdcQueEntry() {
+    vdcQueEntry *entry;
+    while (vdcQueCount == vdcQueSize)
+        pollVdcQue();
+    entry = &vdcQue[vdcQueTail];
+    vdcQueTail = (vdcQueTail + 1) & (vdcQueSize - 1);
+    return entry;
+}
+
+/*
+ * Queue block fill.
+ */
+void queVdcFill(ushort vdcMem, ushort len, uchar value) {
+    vdcQueEntry *entry;
+    if (len > 0) {
+        entry = nextVdcQueEntry();
+        entry->op = vdcQueFill;
+        entry->destMem = vdcMem;
+        entry->len = len;
+        entry->value = value;
+        vdcQueCount++;
+    }
+}
+
+/*
+ * Queue block copy.
+ */
+void queVdcCopy(ushort srcMem, ushort destMem, ushort len) {
+    vdcQueEntry *entry;
+    if (len > 0) {
+        entry = nextVdcQueEntry();
+        entry->op = vdcQueCopy;
+        entry->srcMem = srcMem;
+        entry->destMem = destMem;
+        entry->len = len;
+        vdcQueCount++;
+    }
+}
+
+/*
+ * Issue next block if VDC is ready. Update and source addresses are set for
+ * each block, so other VDC functions can be used between polls. Returns 0 once
+ * all queued operations are complete.
+ */
+uchar pollVdcQue() {
+    vdcQueEntry *entry;
+    uchar blockLen;
+    /* Last block still running? */
+    if ((inp(vdcStatusReg) & 0x80) == 0x00) {
+        return 1;
+    }
+    if (vdcQueCount == 0) {
+        return 0;
+    }
+    entry = &vdcQue[vdcQueHead];
+    if (entry->len > vdcMaxBlock) {
+        blockLen = vdcMaxBlock;
+    } else {
+        blockLen = entry->len;
+    }
+    setVdcUpdAddr(entry->destMem);
+    if (entry->op == vdcQueFill) {
+        outVdc(vdcVtSmScroll, (inVdc(vdcVtSmScroll) & 0x7f));
+        /* First byte is written by data register */
+        outVdc(vdcCPUData, entry->value);
+        if (blockLen > 1)
+            outVdc(vdcWordCnt, blockLen - 1);
+    } else {
+        outVdc(vdcVtSmScroll, (inVdc(vdcVtSmScroll) | 0x80));
+        outVdc(vdcBlkCpySrcAddrHi, (uchar) (entry->srcMem >> 8));
+        outVdc(vdcBlkCpySrcAddrLo, (uchar) entry->srcMem);
+        outVdc(vdcWordCnt, blockLen);
+        entry->srcMem += blockLen;
+    }
+    entry->destMem += blockLen;
+    entry->len -= blockLen;
+    /* Operation done? */
+    if (entry->len == 0) {
+        vdcQueHead = (vdcQueHead + 1) & (vdcQueSize - 1);
+        vdcQueCount--;
+    }
+    return 1;
+}
+
+/*
+ * Wait for all queued operations to complete. Use before reading back VDC
+ * memory written by queued operations.
+ */
+void waitVdcQue() {
+    while (pollVdcQue())
+        ;
+}
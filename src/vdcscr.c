@@ -10,6 +10,39 @@
 #include <screen.h>
 #include <vdc.h>
 
+/*
+ * Text mode register values. 80x50 and 8x16 fonts use interlace. Screen and
+ * attribute memory over 2048 bytes will overlap at the default locations.
+ */
+uchar vdc80x25Regs[] = { vdcVtTotal, 32, vdcVtTotalAdj, 0, vdcVtDisp, 25,
+        vdcVtSyncPos, 29, vdcIlaceMode, 0, vdcChTotalVt, 7, vdcChDspVt, 8 };
+uchar vdc80x30Regs[] = { vdcVtTotal, 32, vdcVtTotalAdj, 0, vdcVtDisp, 30,
+        vdcVtSyncPos, 31, vdcIlaceMode, 0, vdcChTotalVt, 7, vdcChDspVt, 8 };
+uchar vdc80x50Regs[] = { vdcVtTotal, 64, vdcVtTotalAdj, 5, vdcVtDisp, 50,
+        vdcVtSyncPos, 57, vdcIlaceMode, 3, vdcChTotalVt, 7, vdcChDspVt, 8 };
+uchar vdc80x25x16Regs[] = { vdcVtTotal, 31, vdcVtTotalAdj, 13, vdcVtDisp, 25,
+        vdcVtSyncPos, 28, vdcIlaceMode, 3, vdcChTotalVt, 15, vdcChDspVt, 16 };
+
+/*
+ * Text mode register tables and lines.
+ */
+uchar *vdcTxtModes[] = { vdc80x25Regs, vdc80x30Regs, vdc80x50Regs,
+        vdc80x25x16Regs };
+uchar vdcTxtLines[] = { 25, 30, 50, 25 };
+
+/*
+ * Set text mode geometry and screen size.
+ */
+void setVdcTxtMode(uchar mode) {
+    uchar *regs = vdcTxtModes[mode];
+    uchar i;
+    for (i = 0; i < vdcTxtModeRegs; i += 2)
+        outVdc(regs[i], regs[i + 1]);
+    scrWidth = vdcScrCols;
+    scrHeight = vdcTxtLines[mode];
+    scrSize = scrWidth * scrHeight;
+}
+
 /*
  * Sets which disp and attr page is showing.
  */
@@ -67,20 +100,141 @@ void clearVdcCol(uchar c) {
  * Print without color.
  */
 void printVdc(uchar x, uchar y, char *str) {
-    ushort dispOfs = (y * 80) + (ushort) scrMem + x;
-    ushort len = strlen(str);
-    ushort i;
-    outVdc(vdcUpdAddrHi, (uchar) (dispOfs >> 8));
-    outVdc(vdcUpdAddrLo, (uchar) dispOfs);
-    for (i = 0; i < len; i++) {
-        outVdc(vdcCPUData, str[i]);
-    }
+    writeVdcMem((y * scrWidth) + (ushort) scrMem + x, (uchar *) str,
+            strlen(str));
 }
 
 /*
  * Print with color.
  */
 void printVdcCol(uchar x, uchar y, uchar color, char *str) {
-    fillVdcMem((y * 80) + (ushort) scrColMem + x, strlen(str), color);
+    fillVdcMem((y * scrWidth) + (ushort) scrColMem + x, strlen(str), color);
     printVdc(x, y, str);
 }
+
+/*
+ * Scroll VDC memory up 1 line starting at x for len bytes using block copy.
+ * Use scrMem for screen memory and scrColMem for attribute memory.
+ */
+void scrollVdcUpX(ushort vdcMem, uchar x, uchar y, uchar len, uchar lines) {
+    uchar i;
+    ushort destLine = vdcMem + (y * scrWidth) + x;
+    for (i = 0; i < lines; i++) {
+        copyVdcMem(destLine + scrWidth, destLine, len);
+        destLine += scrWidth;
+    }
+}
+
+/*
+ * Scroll VDC memory up 1 line by number of lines.
+ */
+void scrollVdcUp(ushort vdcMem, uchar y, uchar lines) {
+    /* Whole lines are contiguous, so one block copy does it */
+    ushort destLine = vdcMem + (y * scrWidth);
+    copyVdcMem(destLine + scrWidth, destLine, lines * scrWidth);
+}
+
+/*
+ * Scroll VDC memory down 1 line starting at x for len bytes using block copy.
+ * Lines are copied from the bottom up, so y is the top line of the region and
+ * line y + lines receives line y + lines - 1.
+ */
+void scrollVdcDownX(ushort vdcMem, uchar x, uchar y, uchar len, uchar lines) {
+    uchar i;
+    ushort sourceLine = vdcMem + ((y + lines - 1) * scrWidth) + x;
+    for (i = 0; i < lines; i++) {
+        copyVdcMem(sourceLine, sourceLine + scrWidth, len);
+        sourceLine -= scrWidth;
+    }
+}
+
+/*
+ * Scroll VDC memory down 1 line by number of lines.
+ */
+void scrollVdcDown(ushort vdcMem, uchar y, uchar lines) {
+    scrollVdcDownX(vdcMem, 0, y, scrWidth, lines);
+}
+
+/*
+ * Move len bytes right 1 byte. Block copy is ascending, so bytes are moved
+ * through a line buffer starting at the right end. Virtual screens can be up
+ * to 255 columns, so wider lines are moved in vdcScrCols chunks.
+ */
+void moveVdcMemRight(ushort vdcMem, uchar len) {
+    uchar line[vdcScrCols];
+    uchar count;
+    while (len > 0) {
+        if (len > vdcScrCols) {
+            count = vdcScrCols;
+        } else {
+            count = len;
+        }
+        len -= count;
+        readVdcMem(vdcMem + len, line, count);
+        writeVdcMem(vdcMem + len + 1, line, count);
+    }
+}
+
+/*
+ * Scroll w x h rectangle at x, y 1 character in direction dir (scrUp, scrDown,
+ * scrLeft or scrRight). Or in scrCol to move attribute memory too and scrFill
+ * to fill the vacated line or column with c (and color if scrCol is set).
+ */
+void scrollVdcRect(uchar x, uchar y, uchar w, uchar h, uchar dir, uchar c,
+        uchar color) {
+    ushort scrOfs = (ushort) scrMem + (y * scrWidth) + x;
+    ushort colOfs = (ushort) scrColMem + (y * scrWidth) + x;
+    int step = scrWidth;
+    uchar i;
+    if ((dir & 0x0f) == scrUp || (dir & 0x0f) == scrDown) {
+        /* Scroll down from bottom line */
+        if ((dir & 0x0f) == scrDown) {
+            scrOfs += (h - 1) * scrWidth;
+            colOfs += (h - 1) * scrWidth;
+            step = -step;
+        }
+        for (i = 1; i < h; i++) {
+            copyVdcMem(scrOfs + step, scrOfs, w);
+            if (dir & scrCol) {
+                copyVdcMem(colOfs + step, colOfs, w);
+            }
+            scrOfs += step;
+            colOfs += step;
+        }
+        if (dir & scrFill) {
+            fillVdcMem(scrOfs, w, c);
+            if (dir & scrCol) {
+                fillVdcMem(colOfs, w, color);
+            }
+        }
+    } else {
+        for (i = 0; i < h; i++) {
+            if ((dir & 0x0f) == scrLeft) {
+                /* Block copy is ascending, so left is done by the VDC */
+                copyVdcMem(scrOfs + 1, scrOfs, w - 1);
+                if (dir & scrCol) {
+                    copyVdcMem(colOfs + 1, colOfs, w - 1);
+                }
+                if (dir & scrFill) {
+                    fillVdcMem(scrOfs + w - 1, 1, c);
+                    if (dir & scrCol) {
+                        fillVdcMem(colOfs + w - 1, 1, color);
+                    }
+                }
+            } else {
+                moveVdcMemRight(scrOfs, w - 1);
+                if (dir & scrCol) {
+                    moveVdcMemRight(colOfs, w - 1);
+                }
+                if (dir & scrFill) {
+                    fillVdcMem(scrOfs, 1, c);
+                    if (dir & scrCol) {
+                        fillVdcMem(colOfs, 1, color);
+                    }
+                }
+            }
+            scrOfs += scrWidth;
+            colOfs += scrWidth;
+        }
+    }
+}
@@ -0,0 +1,198 @@
+/*
+ * C128 8563 VDC shadow bitmap functions.
+ *
+ * Drawing is done to a copy of the 640x200 bitmap in RAM and dirty byte spans
+ * are tracked per scan line. flushVdcShBmp streams only the changed spans to
+ * VDC memory. Assign these functions to the graphics function pointers and
+ * drawing code works unchanged.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <string.h>
+#include <sys.h>
+#include <hitech.h>
+#include <graphics.h>
+#include <vdc.h>
+
+/*
+ * Shadow bitmap in RAM.
+ */
+uchar *vdcShMem;
+
+/*
+ * First and last dirty byte of each scan line. Line is clean when first > last.
+ */
+uchar vdcShFirst[vdcBmpLines];
+uchar vdcShLast[vdcBmpLines];
+
+/*
+ * Mark all scan lines clean.
+ */
+void cleanVdcShBmp() {
+    memset(vdcShFirst, 0xff, vdcBmpLines);
+    memset(vdcShLast, 0x00, vdcBmpLines);
+}
+
+/*
+ * Set shadow bitmap memory. mem must be vdcBmpSize bytes. bmpMem is still the
+ * VDC bitmap location used by flushVdcShBmp.
+ */
+void setVdcShBmp(uchar *mem) {
+    vdcShMem = mem;
+    cleanVdcShBmp();
+}
+
+/*
+ * Mark span of bytes dirty on scan line.
+ */
+void markVdcShBmp(ushort y, uchar first, uchar last) {
+    if (first < vdcShFirst[y]) {
+        vdcShFirst[y] = first;
+    }
+    if (last > vdcShLast[y]) {
+        vdcShLast[y] = last;
+    }
+}
+
+/*
+ * Stream dirty spans to VDC memory.
+ */
+void flushVdcShBmp() {
+    ushort vdcMem = (ushort) bmpMem;
+    ushort lineOfs = 0;
+    uchar y;
+    for (y = 0; y < vdcBmpLines; y++) {
+        if (vdcShFirst[y] <= vdcShLast[y]) {
+            writeVdcMem(vdcMem + lineOfs + vdcShFirst[y],
+                    &vdcShMem[lineOfs + vdcShFirst[y]],
+                    vdcShLast[y] - vdcShFirst[y] + 1);
+            vdcShFirst[y] = 0xff;
+            vdcShLast[y] = 0x00;
+        }
+        lineOfs += 80;
+    }
+}
+
+/*
+ * Clear shadow and VDC bitmap. VDC uses block fill, so nothing is left dirty.
+ */
+void clearVdcShBmp(uchar c) {
+    memset(vdcShMem, c, vdcBmpSize);
+    fillVdcMem((ushort) bmpMem, bmpSize, c);
+    cleanVdcShBmp();
+}
+
+/*
+ * Set pixel.
+ */
+void setVdcShPix(ushort x, ushort y) {
+    uchar pixCol = x >> 3;
+    vdcShMem[(y << 6) + (y << 4) + pixCol] |= vdcBitTable[x & 0x07];
+    if (pixCol < vdcShFirst[y]) {
+        vdcShFirst[y] = pixCol;
+    }
+    if (pixCol > vdcShLast[y]) {
+        vdcShLast[y] = pixCol;
+    }
+}
+
+/*
+ * Clear pixel.
+ */
+void clearVdcShPix(ushort x, ushort y) {
+    uchar pixCol = x >> 3;
+    vdcShMem[(y << 6) + (y << 4) + pixCol] &= ~vdcBitTable[x & 0x07];
+    if (pixCol < vdcShFirst[y]) {
+        vdcShFirst[y] = pixCol;
+    }
+    if (pixCol > vdcShLast[y]) {
+        vdcShLast[y] = pixCol;
+    }
+}
+
+/*
+ * Optimized horizontal line algorithm. First and last bytes are masked and
+ * bytes between are filled.
+ */
+void drawVdcShLineH(ushort x, ushort y, ushort len, uchar setPix) {
+    uchar *pixByte = &vdcShMem[(y << 6) + (y << 4) + (x >> 3)];
+    uchar firstCol = x >> 3;
+    uchar lastCol = (x + len - 1) >> 3;
+    uchar firstMask = 0xff >> (x & 0x07);
+    uchar lastMask = ~(0x7f >> ((x + len - 1) & 0x07));
+    uchar fillBytes;
+    if (len > 0) {
+        markVdcShBmp(y, firstCol, lastCol);
+        if (firstCol == lastCol) {
+            /* Line starts and ends in same byte */
+            firstMask &= lastMask;
+            if (setPix) {
+                *pixByte |= firstMask;
+            } else {
+                *pixByte &= ~firstMask;
+            }
+        } else {
+            fillBytes = lastCol - firstCol - 1;
+            /* Handle bits on first byte */
+            if (setPix) {
+                *pixByte |= firstMask;
+            } else {
+                *pixByte &= ~firstMask;
+            }
+            pixByte += 1;
+            /* Fill in bytes */
+            if (setPix) {
+                memset(pixByte, 0xff, fillBytes);
+            } else {
+                memset(pixByte, 0x00, fillBytes);
+            }
+            pixByte += fillBytes;
+            /* Handle bits on last byte */
+            if (setPix) {
+                *pixByte |= lastMask;
+            } else {
+                *pixByte &= ~lastMask;
+            }
+        }
+    }
+}
+
+/*
+ * Optimized vertical line algorithm.
+ */
+void drawVdcShLineV(ushort x, ushort y, ushort len, uchar setPix) {
+    uchar *pixByte = &vdcShMem[(y << 6) + (y << 4) + (x >> 3)];
+    uchar pixCol = x >> 3;
+    uchar vBit = vdcBitTable[x & 0x07];
+    uchar i;
+    /* Plot pixels */
+    for (i = 0; i < len; i++) {
+        if (setPix) {
+            *pixByte |= vBit;
+        } else {
+            *pixByte &= ~vBit;
+        }
+        markVdcShBmp(y + i, pixCol, pixCol);
+        pixByte += 80;
+    }
+}
+
+/*
+ * Print without color.
+ */
+void printVdcShBmp(uchar x, uchar y, char *str) {
+    uchar *dispMem = &vdcShMem[((y * 80) * 8) + x];
+    ushort len = strlen(str);
+    ushort i;
+    uchar c;
+    /* Draw 8 scan lines */
+    for (c = 0; c < 8; c++) {
+        for (i = 0; i < len; i++) {
+            dispMem[i] = bmpChrMem[(str[i] << 3) + c];
+        }
+        markVdcShBmp((y * 8) + c, x, x + len - 1);
+        /* Next scan line */
+        dispMem += 80;
+    }
+}
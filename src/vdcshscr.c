@@ -0,0 +1,133 @@
+/*
+ * C128 8563 VDC shadow screen functions.
+ *
+ * Text and attributes are written to a copy of the screen in RAM. Only
+ * bytes that actually change are marked dirty, and the first and last dirty
+ * byte of each row is tracked. syncVdcShScr streams only the changed spans to
+ * VDC memory. Assign these functions to the screen function pointers and
+ * printing code works unchanged.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys.h>
+#include <hitech.h>
+#include <screen.h>
+#include <vdc.h>
+
+/*
+ * Shadow screen and attribute memory in RAM.
+ */
+uchar *vdcShScr, *vdcShCol;
+
+/*
+ * First and last dirty byte of each row. Row is clean when first > last.
+ */
+uchar vdcShScrFirst[vdcMaxScrLines], vdcShScrLast[vdcMaxScrLines];
+uchar vdcShColFirst[vdcMaxScrLines], vdcShColLast[vdcMaxScrLines];
+
+/*
+ * Set shadow screen and attribute memory. Each must be scrSize bytes and is
+ * loaded from VDC screen and attribute memory.
+ */
+void setVdcShScr(uchar *scr, uchar *col) {
+    vdcShScr = scr;
+    vdcShCol = col;
+    readVdcMem((ushort) scrMem, scr, scrSize);
+    readVdcMem((ushort) scrColMem, col, scrSize);
+    memset(vdcShScrFirst, 0xff, vdcMaxScrLines);
+    memset(vdcShScrLast, 0x00, vdcMaxScrLines);
+    memset(vdcShColFirst, 0xff, vdcMaxScrLines);
+    memset(vdcShColLast, 0x00, vdcMaxScrLines);
+}
+
+/*
+ * Put len bytes of str (or value if str is NULL) in shadow memory at x, y
+ * wrapping to next row. Only changed bytes are marked dirty.
+ */
+void putVdcShMem(uchar *mem, uchar *first, uchar *last, uchar x, uchar y,
+        char *str, uchar value, ushort len) {
+    uchar *rowMem = &mem[(y * scrWidth)];
+    uchar c;
+    while ((len > 0) && (y < scrHeight)) {
+        for (; (x < scrWidth) && (len > 0); x++, len--) {
+            if (str != NULL) {
+                c = *str++;
+            } else {
+                c = value;
+            }
+            if (rowMem[x] != c) {
+                rowMem[x] = c;
+                if (x < first[y]) {
+                    first[y] = x;
+                }
+                if (x > last[y]) {
+                    last[y] = x;
+                }
+            }
+        }
+        x = 0;
+        y++;
+        rowMem += scrWidth;
+    }
+}
+
+/*
+ * Stream dirty spans of shadow memory to VDC memory.
+ */
+void syncVdcShMem(uchar *mem, uchar *first, uchar *last, ushort vdcMem) {
+    ushort rowOfs = 0;
+    uchar y;
+    for (y = 0; y < scrHeight; y++) {
+        if (first[y] <= last[y]) {
+            writeVdcMem(vdcMem + rowOfs + first[y], &mem[rowOfs + first[y]],
+                    last[y] - first[y] + 1);
+            first[y] = 0xff;
+            last[y] = 0x00;
+        }
+        rowOfs += scrWidth;
+    }
+}
+
+/*
+ * Stream changed screen and attribute spans to VDC memory.
+ */
+void syncVdcShScr() {
+    syncVdcShMem(vdcShScr, vdcShScrFirst, vdcShScrLast, (ushort) scrMem);
+    syncVdcShMem(vdcShCol, vdcShColFirst, vdcShColLast, (ushort) scrColMem);
+}
+
+/*
+ * Clear screen.
+ */
+void clearVdcShScr(uchar c) {
+    putVdcShMem(vdcShScr, vdcShScrFirst, vdcShScrLast, 0, 0, NULL, c,
+            scrSize);
+}
+
+/*
+ * Clear screen color.
+ */
+void clearVdcShCol(uchar c) {
+    putVdcShMem(vdcShCol, vdcShColFirst, vdcShColLast, 0, 0, NULL, c,
+            scrSize);
+}
+
+/*
+ * Print without color.
+ */
+void printVdcSh(uchar x, uchar y, char *str) {
+    putVdcShMem(vdcShScr, vdcShScrFirst, vdcShScrLast, x, y, str, 0,
+            strlen(str));
+}
+
+/*
+ * Print with color.
+ */
+void printVdcShCol(uchar x, uchar y, uchar color, char *str) {
+    ushort len = strlen(str);
+    putVdcShMem(vdcShCol, vdcShColFirst, vdcShColLast, x, y, NULL, color, len);
+    putVdcShMem(vdcShScr, vdcShScrFirst, vdcShScrLast, x, y, str, 0, len);
+}
@@ -0,0 +1,74 @@
+/*
+ * C128 8563 VDC virtual screen functions.
+ *
+ * The display is a window into a virtual screen wider and/or taller than
+ * 80x25. Register 27 skips the columns that are not displayed, so panning only
+ * changes the display start and smooth scroll registers. 160x50 text with
+ * attributes needs 16000 bytes, thus 64K VDC memory.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <string.h>
+#include <hitech.h>
+#include <screen.h>
+#include <vdc.h>
+
+/*
+ * Virtual screen columns and rows.
+ */
+uchar vdcVirtCols, vdcVirtRows;
+
+/*
+ * Virtual screen and attribute memory.
+ */
+ushort vdcVirtScr, vdcVirtCol;
+
+/*
+ * Set virtual screen. cols must be 80 or more. Screen memory and geometry are
+ * set to the virtual screen, so the standard VDC screen functions work too.
+ */
+void setVdcVirtScr(ushort scr, ushort attr, uchar cols, uchar rows) {
+    vdcVirtScr = scr;
+    vdcVirtCol = attr;
+    vdcVirtCols = cols;
+    vdcVirtRows = rows;
+    scrMem = (uchar *) scr;
+    scrColMem = (uchar *) attr;
+    scrWidth = cols;
+    scrHeight = rows;
+    scrSize = cols * rows;
+    outVdc(vdcAddrIncPerRow, cols - 80);
+    panVdcVirtScr(0, 0);
+}
+
+/*
+ * Pan display to pixel position in virtual screen. Coarse position is set by
+ * display and attribute start address and fine position by smooth scrolling.
+ */
+void panVdcVirtScr(ushort x, ushort y) {
+    ushort ofs = ((y >> 3) * vdcVirtCols) + (x >> 3);
+    uchar hzScroll = (inVdc(vdcHzSmScroll) & 0xf0) | (7 - (x & 0x07));
+    uchar vtScroll = (inVdc(vdcVtSmScroll) & 0xe0) | (y & 0x07);
+    waitVdcVBlank();
+    setVdcDspPage(vdcVirtScr + ofs, vdcVirtCol + ofs);
+    outVdc(vdcHzSmScroll, hzScroll);
+    outVdc(vdcVtSmScroll, vtScroll);
+}
+
+/*
+ * Print without color using virtual screen coordinates.
+ */
+void printVdcVirt(uchar x, uchar y, char *str) {
+    writeVdcMem(vdcVirtScr + (y * vdcVirtCols) + x, (uchar *) str,
+            strlen(str));
+}
+
+/*
+ * Print with color using virtual screen coordinates.
+ */
+void printVdcVirtCol(uchar x, uchar y, uchar color, char *str) {
+    fillVdcMem(vdcVirtCol + (y * vdcVirtCols) + x, strlen(str), color);
+    printVdcVirt(x, y, str);
+}
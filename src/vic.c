@@ -46,6 +46,7 @@ void setVicBank(uchar vicBank) {
     outp(cia2DdrA, saveDdr);
 }
 
+#ifndef VICASM
 /*
  * Fill memory with word value starting at start.
  */
@@ -57,6 +58,58 @@ void fillVicMem(uchar *mem, ushort start, ushort len, ushort value) {
     }
 }
 
+/*
+ * Fill color memory (I/O mapped) with color.
+ */
+void fillVicCol(ushort colMem, ushort len, uchar color) {
+    register ushort i;
+    for (i = 0; i < len; i++) {
+        outp(colMem + i, color);
+    }
+}
+
+/*
+ * Copy memory to color memory.
+ */
+void writeVicCol(ushort colMem, uchar *mem, ushort len) {
+    register ushort i;
+    for (i = 0; i < len; i++) {
+        outp(colMem + i, mem[i]);
+    }
+}
+
+/*
+ * Copy color memory to memory. Upper nibble of each byte is undefined.
+ */
+void readVicCol(ushort colMem, uchar *mem, ushort len) {
+    register ushort i;
+    for (i = 0; i < len; i++) {
+        mem[i] = inp(colMem + i);
+    }
+}
+#endif
+
+/*
+ * Copy color memory to color memory a line at a time. Destination must be
+ * below source or at least a line away.
+ */
+void copyVicCol(ushort srcCol, ushort destCol, ushort len) {
+    uchar line[vicScrCols];
+    uchar count;
+    while (len > 0) {
+        if (len > vicScrCols) {
+            count = vicScrCols;
+        } else {
+            count = len;
+        }
+        readVicCol(srcCol, line, count);
+        writeVicCol(destCol, line, count);
+        srcCol += count;
+        destCol += count;
+        len -= count;
+    }
+}
+
 /*
  * Set ecm, bmm and mcm to 0 (off) or 1 (on).
  */
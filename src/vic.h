@@ -56,18 +56,46 @@
 
 #define vicColMem 0xd800  /* VIC I/O mapped color memory */
 #define vicScrSize 1000   /* VIC screen size in bytes */
+#define vicScrCols 40     /* VIC screen size in columns */
+#define vicScrLines 25    /* VIC screen size in lines */
 #define vicBmpSize 8000   /* VIC bitmap size in bytes */
+#define vicRasSize 8      /* Raster timeline lines */
+#define vicRasRegs 6      /* Raster timeline register writes per line */
+#define vicRasNone 0xff   /* No raster timeline line */
+#define vicRasNoLine 0xffff /* Empty raster timeline */
 #define vicSprMemOfs 1016 /* Sprite memory pointers offset in screen.  */
+#define vicSprHeight 21   /* Sprite height in raster lines */
+#define vicMuxSize 32     /* Multiplexed logical sprites */
+#define vicSheetNone 0xff /* No sprite sheet slot */
+#define vicObjSize 32     /* Software collision objects */
+#define vicCollGridCols 8 /* Collision grid columns of 64 pixels */
+#define vicCollGridRows 4 /* Collision grid rows of 64 pixels */
+#define vicSprShSize 47   /* Shadow sprite registers 0xd000-0xd02e */
+
+extern uchar sprTable[];
 
 extern uchar *allocVicMem(uchar maxBank);
 extern void setVicMmuBank(uchar mmuRcr);
 extern void setVicBank(uchar vicBank);
 extern void fillVicMem(uchar *mem, ushort start, ushort len, ushort value);
+extern void fillVicCol(ushort colMem, ushort len, uchar color);
+extern void writeVicCol(ushort colMem, uchar *mem, ushort len);
+extern void readVicCol(ushort colMem, uchar *mem, ushort len);
+extern void copyVicCol(ushort srcCol, ushort destCol, ushort len);
 extern void setVicMode(uchar ecm, uchar bmm, uchar mcm);
 extern void setVicScrMem(uchar scrLoc);
 extern void setVicChrMem(uchar chrLoc);
 extern void setVicChrMode(uchar mmuRcr, uchar vicBank, uchar scrLoc,
         uchar chrLoc);
+extern void setVicEcmMode(uchar mmuRcr, uchar vicBank, uchar scrLoc,
+        uchar chrLoc);
+extern void setVicMcmChrMode(uchar mmuRcr, uchar vicBank, uchar scrLoc,
+        uchar chrLoc);
+extern void setVicBgCols(uchar bg0, uchar bg1, uchar bg2, uchar bg3);
+extern void copyVicEcmChr(uchar *srcChr, uchar *destChr);
+extern void printVicEcm(uchar x, uchar y, uchar bg, char *str);
+extern void printVicEcmCol(uchar x, uchar y, uchar color, uchar bg, char *str);
+extern void printVicMcmCol(uchar x, uchar y, uchar color, char *str);
 extern void clearVicScr(uchar c);
 extern void clearVicCol(uchar c);
 extern void printVic(uchar x, uchar y, char *str);
@@ -76,6 +104,32 @@ extern void printVicPet(uchar x, uchar y, char *str);
 extern void printVicColPet(uchar x, uchar y, uchar color, char *str);
 extern void scrollVicUpX(uchar *scr, uchar x, uchar y, uchar len, uchar lines);
 extern void scrollVicUp(uchar *scr, uchar y, uchar lines);
+extern void scrollVicColUpX(uchar x, uchar y, uchar len, uchar lines);
+extern void scrollVicColDownX(uchar x, uchar y, uchar len, uchar lines);
+extern void scrollVicRect(uchar x, uchar y, uchar w, uchar h, uchar dir,
+        uchar c, uchar color);
+extern void waitVicVBlank();
+extern void setVicBackPage();
+extern void setVicDspPage(uchar *scr, uchar *bmp);
+extern void setVicPages(uchar *scr0, uchar *scr1, uchar *bmp0, uchar *bmp1);
+extern void flipVicPage();
+extern void clearVicRas();
+extern uchar addVicRas(ushort line);
+extern void addVicRasReg(uchar index, ushort port, uchar value);
+extern void setVicRasMode(uchar index, uchar ecm, uchar bmm, uchar mcm);
+extern void setVicRasChrMem(uchar index, uchar scrLoc, uchar chrLoc);
+extern void setVicRasBmpMem(uchar index, uchar scrLoc, uchar bmpLoc);
+extern ushort getVicRaster();
+extern void outVicRegs(uchar *regs, uchar count);
+extern ushort nextVicRas();
+extern void runVicRas();
+extern void setVicFineScroll(uchar dir, uchar fine);
+extern void (*vicSmoothEdge)(uchar *edge, uchar step, uchar len);
+extern void edgeVicSmooth(uchar *back);
+extern void prepVicSmooth();
+extern void initVicSmooth(uchar *scr0, uchar *scr1, uchar dir, uchar c);
+extern void scrollVicSmooth();
+extern void doneVicSmooth();
 extern char *readVicLine(uchar *scr, uchar x, uchar y, uchar len);
 extern void setVicBmpMem(uchar bmpLoc);
 extern void setVicBmpMode(uchar mmuRcr, uchar vicBank, uchar scrLoc,
@@ -88,10 +142,63 @@ extern void drawVicLineH(ushort x, ushort y, ushort len,
         uchar setPix);
 extern void drawVicLineV(ushort x, ushort y, ushort len,
         uchar setPix);
+extern void drawVicLineD(int x0, int y0, int x1, int y1, uchar setPix);
 extern void printVicBmp(uchar x, uchar y, uchar color, char *str);
+extern void setVicMcmBmpMode(uchar mmuRcr, uchar vicBank, uchar scrLoc,
+        uchar bmpLoc);
+extern void setVicMcmColor(uchar color);
+extern void setVicMcmCol(uchar bg, uchar color1, uchar color2, uchar color3);
+extern void setVicMcmCell(uchar x, uchar y, uchar color1, uchar color2,
+        uchar color3);
+extern void clearVicMcmBmp(uchar c);
+extern void clearVicMcmCol(uchar c);
+extern void setVicMcmPix(ushort x, ushort y);
+extern void clearVicMcmPix(ushort x, ushort y);
+extern void drawVicMcmLineH(ushort x, ushort y, ushort len, uchar setPix);
+extern void drawVicMcmLineV(ushort x, ushort y, ushort len, uchar setPix);
+extern void fillVicMcmRect(ushort x, ushort y, ushort w, ushort h);
 extern void configVicSpr(uchar *scr, uchar *spr, uchar sprNum, uchar sprCol);
 extern void enableVicSpr(uchar sprNum);
 extern void disableVicSpr(uchar sprNum);
 extern void setVicSprLoc(uchar sprNum, ushort x, uchar y);
 extern void setVicSprFg(uchar sprNum);
 extern void setVicSprBg(uchar sprNum);
+extern void enableVicSprMcm(uchar sprNum);
+extern void disableVicSprMcm(uchar sprNum);
+extern void setVicSprMcmCol(uchar color0, uchar color1);
+extern void setVicSprExp(uchar sprNum, uchar xExp, uchar yExp);
+extern void initVicSheet(uchar *sheet, uchar slots);
+extern uchar addVicSheet(uchar *spr, uchar frames);
+extern void setVicSheetSpr(uchar *scr, uchar sprNum, uchar slot);
+extern void setVicSheetAnim(uchar *scr, uchar sprNum, uchar slot, uchar frames,
+        uchar ticks);
+extern void tickVicSheet(uchar *scr);
+extern void initVicShSpr();
+extern void putVicShSpr(uchar reg, uchar value);
+extern void setVicShSprLoc(uchar sprNum, ushort x, uchar y);
+extern void enableVicShSpr(uchar sprNum);
+extern void disableVicShSpr(uchar sprNum);
+extern void setVicShSprFg(uchar sprNum);
+extern void setVicShSprBg(uchar sprNum);
+extern void setVicShSprCol(uchar sprNum, uchar sprCol);
+extern void flushVicSpr();
+extern void latchVicColl();
+extern uchar getVicSprColl(uchar sprNum);
+extern uchar getVicSprFgColl(uchar sprNum);
+extern uchar getVicSprPairColl(uchar sprNum0, uchar sprNum1);
+extern uchar testVicCollBox(ushort x0, uchar y0, uchar w0, uchar h0,
+        ushort x1, uchar y1, uchar w1, uchar h1);
+extern uchar testVicCollMask(uchar objNum0, uchar objNum1);
+extern void initVicObj(uchar count);
+extern void setVicObj(uchar objNum, ushort x, uchar y, uchar w, uchar h,
+        uchar *mask);
+extern void setVicObjLoc(uchar objNum, ushort x, uchar y);
+extern void testVicObjColl();
+extern uchar getVicObjColl(uchar objNum);
+extern uchar getVicObjPairColl(uchar objNum0, uchar objNum1);
+extern void initVicMux(uchar *scr, uchar count);
+extern void configVicMux(uchar *spr, uchar sprNum, uchar sprCol);
+extern void setVicMuxLoc(uchar sprNum, ushort x, uchar y);
+extern void sortVicMux();
+extern void setVicMuxSpr(uchar hwNum, uchar sprNum);
+extern void runVicMux();
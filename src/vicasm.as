@@ -0,0 +1,295 @@
+;
+; C128 CP/M 8564/8566 VIC-IIe Z80 kernels.
+;
+; Assembly versions of fillVicMem, printVic, scrollVicUpX, printVicBmp, the
+; color memory block I/O functions fillVicCol, writeVicCol and readVicCol and
+; the raster timeline register writer outVicRegs. The C versions are compiled
+; out when VICASM is defined, so remove -DVICASM and vicasm.as from obj.mak
+; (and vicasm.obj from lib.mak) to go back to C.
+;
+; T-states estimated from Z80 instruction timings (not including C128 wait
+; states):
+;   clearVicBmp 8000 bytes  C ~600000  asm ~168000 (LDIR 21 per byte)
+;   printVic 40 chars       C ~9000    asm ~1600
+;   scrollVicUp 24 lines    C ~190000  asm ~20500
+;   printVicBmp 40 chars    C ~34000   asm ~8200
+;   clearVicCol 1000 bytes  C ~150000  asm ~44000
+;
+; Copyright (c) Steven P. Goldsmith. All rights reserved.
+;
+
+	psect	text
+	global	csv, cret
+	global	_scrMem, _scrWidth, _bmpMem, _bmpColMem, _bmpChrMem
+	global	_fillVicMem, _printVic, _scrollVicUpX, _printVicBmp
+	global	_fillVicCol, _writeVicCol, _readVicCol, _outVicRegs
+
+;
+; void fillVicMem(uchar *mem, ushort start, ushort len, ushort value)
+;
+; First word is stored and LDIR copies it forward over the rest.
+;
+_fillVicMem:
+	call	csv
+	ld	l,(ix+6)	; hl = mem + start * 2
+	ld	h,(ix+7)
+	ld	e,(ix+8)
+	ld	d,(ix+9)
+	add	hl,de
+	add	hl,de
+	ld	c,(ix+10)	; bc = len
+	ld	b,(ix+11)
+	ld	a,b
+	or	c
+	jp	z,cret
+	ld	e,(ix+12)	; store first word
+	ld	d,(ix+13)
+	ld	(hl),e
+	inc	hl
+	ld	(hl),d
+	inc	hl
+	dec	bc
+	ld	a,b
+	or	c
+	jp	z,cret
+	sla	c		; bc = remaining bytes
+	rl	b
+	ld	d,h		; de = next word
+	ld	e,l
+	dec	hl		; hl = first word
+	dec	hl
+	ldir
+	jp	cret
+
+;
+; void printVic(uchar x, uchar y, char *str)
+;
+_printVic:
+	call	csv
+	ld	a,(_scrWidth)	; hl = y * scrWidth
+	ld	e,a
+	ld	d,0
+	ld	hl,0
+	ld	b,(ix+8)
+	ld	a,b
+	or	a
+	jr	z,pv2
+pv1:	add	hl,de
+	djnz	pv1
+pv2:	ld	e,(ix+6)	; de = scrMem + y * scrWidth + x
+	add	hl,de
+	ld	de,(_scrMem)
+	add	hl,de
+	ex	de,hl
+	ld	l,(ix+10)	; hl = str
+	ld	h,(ix+11)
+pv3:	ld	a,(hl)
+	or	a
+	jp	z,cret
+	ldi
+	jr	pv3
+
+;
+; void scrollVicUpX(uchar *scr, uchar x, uchar y, uchar len, uchar lines)
+;
+; x and len are in words.
+;
+_scrollVicUpX:
+	call	csv
+	ld	a,(_scrWidth)	; hl = y * scrWidth
+	ld	e,a
+	ld	d,0
+	ld	hl,0
+	ld	b,(ix+10)
+	ld	a,b
+	or	a
+	jr	z,su2
+su1:	add	hl,de
+	djnz	su1
+su2:	ld	c,(ix+8)	; hl = scr + y * scrWidth + x * 2
+	ld	b,0
+	add	hl,bc
+	add	hl,bc
+	ld	c,(ix+6)
+	ld	b,(ix+7)
+	add	hl,bc
+	ld	a,(ix+12)	; nothing to move?
+	or	a
+	jp	z,cret
+	ld	a,(ix+14)
+	or	a
+	jp	z,cret
+su3:	ld	d,h		; de = destination line
+	ld	e,l
+	ld	a,(_scrWidth)	; hl = source line
+	add	a,l
+	ld	l,a
+	adc	a,h
+	sub	l
+	ld	h,a
+	push	hl
+	ld	c,(ix+12)	; bc = len * 2
+	ld	b,0
+	sla	c
+	rl	b
+	ldir
+	pop	hl		; source line is next destination line
+	dec	(ix+14)
+	jr	nz,su3
+	jp	cret
+
+;
+; void printVicBmp(uchar x, uchar y, uchar color, char *str)
+;
+; Cell = y * 40 + x, color goes to bmpColMem + cell and glyph to bmpMem + cell * 8.
+;
+_printVicBmp:
+	call	csv
+	ld	l,(ix+8)	; hl = y * 40 + x
+	ld	h,0
+	add	hl,hl
+	add	hl,hl
+	add	hl,hl
+	ld	d,h
+	ld	e,l
+	add	hl,hl
+	add	hl,hl
+	add	hl,de
+	ld	e,(ix+6)
+	ld	d,0
+	add	hl,de
+	push	hl		; iy = bmpColMem + cell
+	ld	de,(_bmpColMem)
+	add	hl,de
+	push	hl
+	pop	iy
+	pop	hl		; de = bmpMem + cell * 8
+	add	hl,hl
+	add	hl,hl
+	add	hl,hl
+	ld	de,(_bmpMem)
+	add	hl,de
+	ex	de,hl
+pb1:	ld	l,(ix+12)	; next character
+	ld	h,(ix+13)
+	ld	a,(hl)
+	or	a
+	jp	z,cret
+	inc	hl
+	ld	(ix+12),l
+	ld	(ix+13),h
+	ld	c,(ix+10)	; color
+	ld	(iy+0),c
+	inc	iy
+	ld	l,a		; hl = bmpChrMem + character * 8
+	ld	h,0
+	add	hl,hl
+	add	hl,hl
+	add	hl,hl
+	ld	bc,(_bmpChrMem)
+	add	hl,bc
+	ldi			; copy glyph, de ends on next cell
+	ldi
+	ldi
+	ldi
+	ldi
+	ldi
+	ldi
+	ldi
+	jr	pb1
+;
+; Color memory is I/O mapped, so BC holds the full 16 bit port and is
+; incremented per byte. OTIR/INIR can not be used since they count down B,
+; which is the high byte of the port.
+;
+
+;
+; void fillVicCol(ushort colMem, ushort len, uchar color)
+;
+_fillVicCol:
+	call	csv
+	ld	c,(ix+6)	; bc = color memory port
+	ld	b,(ix+7)
+	ld	e,(ix+8)	; de = len
+	ld	d,(ix+9)
+	ld	a,d
+	or	e
+	jp	z,cret
+	ld	h,(ix+10)	; h = color
+fc1:	out	(c),h
+	inc	bc
+	dec	de
+	ld	a,d
+	or	e
+	jr	nz,fc1
+	jp	cret
+
+;
+; void writeVicCol(ushort colMem, uchar *mem, ushort len)
+;
+_writeVicCol:
+	call	csv
+	ld	c,(ix+6)	; bc = color memory port
+	ld	b,(ix+7)
+	ld	l,(ix+8)	; hl = mem
+	ld	h,(ix+9)
+	ld	e,(ix+10)	; de = len
+	ld	d,(ix+11)
+	ld	a,d
+	or	e
+	jp	z,cret
+wc1:	inc	b		; OUTI puts B - 1 on the bus
+	outi
+	inc	bc
+	dec	de
+	ld	a,d
+	or	e
+	jr	nz,wc1
+	jp	cret
+
+;
+; void readVicCol(ushort colMem, uchar *mem, ushort len)
+;
+_readVicCol:
+	call	csv
+	ld	c,(ix+6)	; bc = color memory port
+	ld	b,(ix+7)
+	ld	l,(ix+8)	; hl = mem
+	ld	h,(ix+9)
+	ld	e,(ix+10)	; de = len
+	ld	d,(ix+11)
+	ld	a,d
+	or	e
+	jp	z,cret
+rc1:	ini			; INI puts B on the bus then decrements it
+	inc	b
+	inc	bc
+	dec	de
+	ld	a,d
+	or	e
+	jr	nz,rc1
+	jp	cret
+
+;
+; void outVicRegs(uchar *regs, uchar count)
+;
+; Write count register/value pairs. All VIC registers are 0xd0xx, so B is
+; fixed and each write is OUT (C),A (54 T-states per register).
+;
+_outVicRegs:
+	call	csv
+	ld	l,(ix+6)	; hl = regs
+	ld	h,(ix+7)
+	ld	e,(ix+8)	; e = count
+	ld	a,e
+	or	a
+	jp	z,cret
+	ld	b,0D0h		; b = VIC I/O page
+or1:	ld	c,(hl)		; c = register
+	inc	hl
+	ld	a,(hl)		; a = value
+	inc	hl
+	out	(c),a
+	dec	e
+	jr	nz,or1
+	jp	cret
@@ -4,6 +4,7 @@
  * Copyright (c) Steven P. Goldsmith. All rights reserved.
  */
 
+#include <stdlib.h>
 #include <sys.h>
 #include <string.h>
 #include <hitech.h>
@@ -129,6 +130,67 @@ void drawVicLineV(ushort x, ushort y, ushort len, uchar setPix) {
     }
 }
 
+/*
+ * Bresenham line that steps the pixel byte and bit instead of calculating
+ * them for each pixel. Bytes are 1 apart within a cell, 8 apart across cells
+ * and 313 apart across cell lines.
+ */
+void drawVicLineD(int x0, int y0, int x1, int y1, uchar setPix) {
+    int dx = abs(x1 - x0);
+    int dy = abs(y1 - y0);
+    int err = (dx > dy ? dx : -dy) / 2, e2;
+    int count = (dx > dy ? dx : dy) + 1;
+    uchar xInc = x0 < x1;
+    uchar yInc = y0 < y1;
+    uchar cellY = y0 & 0x07;
+    uchar vBit = bitTable[x0 & 0x07];
+    register ushort pixByte = 40 * (y0 & 0xf8) + (x0 & 0x1f8) + cellY;
+    while (count-- > 0) {
+        if (setPix) {
+            bmpMem[pixByte] = bmpMem[pixByte] | vBit;
+        } else {
+            bmpMem[pixByte] = bmpMem[pixByte] & ~vBit;
+        }
+        e2 = err;
+        if (e2 > -dx) {
+            err -= dy;
+            if (xInc) {
+                vBit >>= 1;
+                if (vBit == 0) {
+                    vBit = 0x80;
+                    pixByte += 8;
+                }
+            } else {
+                vBit <<= 1;
+                if (vBit == 0) {
+                    vBit = 0x01;
+                    pixByte -= 8;
+                }
+            }
+        }
+        if (e2 < dy) {
+            err += dx;
+            /* Step based on char boundary */
+            if (yInc) {
+                if (++cellY < 8) {
+                    pixByte += 1;
+                } else {
+                    cellY = 0;
+                    pixByte += 313;
+                }
+            } else {
+                if (cellY-- > 0) {
+                    pixByte -= 1;
+                } else {
+                    cellY = 7;
+                    pixByte -= 313;
+                }
+            }
+        }
+    }
+}
+
+#ifndef VICASM
 /*
  * Print with foreground/background color.
  */
@@ -149,3 +211,4 @@ void printVicBmp(uchar x, uchar y, uchar color, char *str) {
         }
     }
 }
+#endif
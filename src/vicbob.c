@@ -0,0 +1,70 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe software sprite (BOB) functions.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <hitech.h>
+#include <graphics.h>
+#include <vic.h>
+
+/*
+ * Save background and draw BOB at pixel x, y. BOB is clipped at the right and
+ * bottom of the bitmap and not drawn if x, y is off the bitmap.
+ */
+void drawVicBob(bmpBob *bob, ushort x, ushort y) {
+    ushort size = bob->w * bob->h;
+    uchar *img = bob->img + ((x & 0x07) * size);
+    uchar *mask = img + (size << 3);
+    uchar *save = bob->save;
+    ushort pixByte;
+    uchar i, j, b, skip;
+    bob->drawn = 0;
+    if ((x >> 3) < vicScrCols && y < (vicScrLines << 3)) {
+        bob->x = x;
+        bob->y = y;
+        bob->clipW = bob->w;
+        bob->clipH = bob->h;
+        if ((x >> 3) + bob->clipW > vicScrCols) {
+            bob->clipW = vicScrCols - (x >> 3);
+        }
+        if (y + bob->clipH > (vicScrLines << 3)) {
+            bob->clipH = (vicScrLines << 3) - y;
+        }
+        skip = bob->w - bob->clipW;
+        for (i = 0; i < bob->clipH; i++, y++) {
+            pixByte = 40 * (y & 0xf8) + (x & 0x1f8) + (y & 0x07);
+            for (j = 0; j < bob->clipW; j++) {
+                b = bmpMem[pixByte];
+                *save++ = b;
+                bmpMem[pixByte] = (b & ~*mask++) | *img++;
+                /* Next byte is 8 bytes over in the same cell line */
+                pixByte += 8;
+            }
+            img += skip;
+            mask += skip;
+        }
+        bob->drawn = 1;
+    }
+}
+
+/*
+ * Restore background under BOB.
+ */
+void eraseVicBob(bmpBob *bob) {
+    uchar *save = bob->save;
+    ushort x = bob->x;
+    ushort y = bob->y;
+    ushort pixByte;
+    uchar i, j;
+    if (bob->drawn) {
+        for (i = 0; i < bob->clipH; i++, y++) {
+            pixByte = 40 * (y & 0xf8) + (x & 0x1f8) + (y & 0x07);
+            for (j = 0; j < bob->clipW; j++) {
+                bmpMem[pixByte] = *save++;
+                pixByte += 8;
+            }
+        }
+        bob->drawn = 0;
+    }
+}
@@ -0,0 +1,215 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe collision functions.
+ *
+ * Hardware collision registers clear on read, so they are latched once per
+ * frame and all queries use the latched values. Software collision covers
+ * objects the hardware can't see such as multiplexed sprites and bitmap
+ * objects. A coarse grid of 64x64 pixel cells limits which pairs are tested.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <vic.h>
+
+/*
+ * Software collision object. Mask is 1 bit per pixel, (w + 7) / 8 bytes per
+ * line with the left most pixel in bit 7, the same as sprite data. A 0 mask
+ * uses the bounding box only.
+ */
+typedef struct {
+    ushort x;
+    uchar y;
+    uchar w;
+    uchar h;
+    uchar *mask;
+} vicCollObj;
+
+/*
+ * Latched sprite-sprite and sprite-foreground collisions.
+ */
+uchar vicCollSpr, vicCollFg;
+
+/*
+ * Software collision objects and objects each one hits.
+ */
+vicCollObj vicObj[vicObjSize];
+ulong vicObjHits[vicObjSize];
+
+/*
+ * Number of software collision objects.
+ */
+uchar vicObjCount;
+
+/*
+ * Objects touching each grid cell.
+ */
+ulong vicCollGrid[vicCollGridCols * vicCollGridRows];
+
+/*
+ * Latch hardware collision registers. Call once per frame.
+ */
+void latchVicColl() {
+    vicCollSpr = inp(vicSprColl);
+    vicCollFg = inp(vicSprFgColl);
+}
+
+/*
+ * Return non-zero if sprite hit another sprite.
+ */
+uchar getVicSprColl(uchar sprNum) {
+    return vicCollSpr & sprTable[sprNum];
+}
+
+/*
+ * Return non-zero if sprite hit foreground.
+ */
+uchar getVicSprFgColl(uchar sprNum) {
+    return vicCollFg & sprTable[sprNum];
+}
+
+/*
+ * Return non-zero if both sprites hit another sprite. Hardware does not
+ * report pairs, so this is exact only when two sprites collided.
+ */
+uchar getVicSprPairColl(uchar sprNum0, uchar sprNum1) {
+    uchar bits = sprTable[sprNum0] | sprTable[sprNum1];
+    return (vicCollSpr & bits) == bits;
+}
+
+/*
+ * Return non-zero if bounding boxes overlap.
+ */
+uchar testVicCollBox(ushort x0, uchar y0, uchar w0, uchar h0, ushort x1,
+        uchar y1, uchar w1, uchar h1) {
+    return x0 < x1 + w1 && x1 < x0 + w0 && y0 < y1 + h1 && y1 < y0 + h0;
+}
+
+/*
+ * Return pixel of object mask.
+ */
+uchar getVicCollPix(vicCollObj *obj, uchar x, uchar y) {
+    ushort pixByte = y * ((obj->w + 7) >> 3) + (x >> 3);
+    return obj->mask == 0 || (obj->mask[pixByte] & (0x80 >> (x & 7))) != 0;
+}
+
+/*
+ * Return non-zero if object masks overlap. Only the overlapping rectangle is
+ * tested.
+ */
+uchar testVicCollMask(uchar objNum0, uchar objNum1) {
+    vicCollObj *obj0 = &vicObj[objNum0];
+    vicCollObj *obj1 = &vicObj[objNum1];
+    ushort left, right, top, bottom, x, y;
+    if (!testVicCollBox(obj0->x, obj0->y, obj0->w, obj0->h, obj1->x, obj1->y,
+            obj1->w, obj1->h)) {
+        return 0;
+    }
+    if (obj0->mask == 0 && obj1->mask == 0) {
+        return 1;
+    }
+    left = obj0->x > obj1->x ? obj0->x : obj1->x;
+    top = obj0->y > obj1->y ? obj0->y : obj1->y;
+    right = obj0->x + obj0->w < obj1->x + obj1->w ?
+            obj0->x + obj0->w : obj1->x + obj1->w;
+    bottom = obj0->y + obj0->h < obj1->y + obj1->h ?
+            obj0->y + obj0->h : obj1->y + obj1->h;
+    for (y = top; y < bottom; y++) {
+        for (x = left; x < right; x++) {
+            if (getVicCollPix(obj0, x - obj0->x, y - obj0->y)
+                    && getVicCollPix(obj1, x - obj1->x, y - obj1->y)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Set number of software collision objects. Count is limited to vicObjSize
+ * since objects hit are kept as bits of a ulong.
+ */
+void initVicObj(uchar count) {
+    if (count > vicObjSize) {
+        count = vicObjSize;
+    }
+    vicObjCount = count;
+}
+
+/*
+ * Set software collision object location, size and mask.
+ */
+void setVicObj(uchar objNum, ushort x, uchar y, uchar w, uchar h, uchar *mask) {
+    vicCollObj *obj = &vicObj[objNum];
+    obj->x = x;
+    obj->y = y;
+    obj->w = w;
+    obj->h = h;
+    obj->mask = mask;
+}
+
+/*
+ * Set software collision object location.
+ */
+void setVicObjLoc(uchar objNum, ushort x, uchar y) {
+    vicObj[objNum].x = x;
+    vicObj[objNum].y = y;
+}
+
+/*
+ * Test all software collision objects. Objects are added to each grid cell
+ * they touch and only objects sharing a cell are tested.
+ */
+void testVicObjColl() {
+    vicCollObj *obj;
+    ulong bit, others;
+    uchar i, j, col, row, firstCol, lastCol, firstRow, lastRow;
+    for (i = 0; i < vicCollGridCols * vicCollGridRows; i++) {
+        vicCollGrid[i] = 0;
+    }
+    for (i = 0; i < vicObjCount; i++) {
+        vicObjHits[i] = 0;
+    }
+    for (i = 0, bit = 1; i < vicObjCount; i++, bit <<= 1) {
+        obj = &vicObj[i];
+        firstCol = obj->x >> 6;
+        lastCol = (obj->x + obj->w - 1) >> 6;
+        firstRow = obj->y >> 6;
+        lastRow = (obj->y + obj->h - 1) >> 6;
+        if (lastCol >= vicCollGridCols) {
+            lastCol = vicCollGridCols - 1;
+        }
+        if (lastRow >= vicCollGridRows) {
+            lastRow = vicCollGridRows - 1;
+        }
+        /* Objects already in cells are tested against this one */
+        others = 0;
+        for (row = firstRow; row <= lastRow; row++) {
+            for (col = firstCol; col <= lastCol; col++) {
+                others |= vicCollGrid[row * vicCollGridCols + col];
+                vicCollGrid[row * vicCollGridCols + col] |= bit;
+            }
+        }
+        for (j = 0; others != 0; j++, others >>= 1) {
+            if ((others & 1) != 0 && testVicCollMask(i, j)) {
+                vicObjHits[i] |= (ulong) 1 << j;
+                vicObjHits[j] |= bit;
+            }
+        }
+    }
+}
+
+/*
+ * Return non-zero if object hit another object.
+ */
+uchar getVicObjColl(uchar objNum) {
+    return vicObjHits[objNum] != 0;
+}
+
+/*
+ * Return non-zero if objects hit each other.
+ */
+uchar getVicObjPairColl(uchar objNum0, uchar objNum1) {
+    return (vicObjHits[objNum0] & ((ulong) 1 << objNum1)) != 0;
+}
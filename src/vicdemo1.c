@@ -113,6 +113,8 @@ main() {
     uchar background = inp(vicBgCol0);
     /* Set default sizes and locations */
     scrSize = vicScrSize;
+    scrWidth = vicScrCols;
+    scrHeight = vicScrLines;
     scrMem = scr;
     scrColMem = (uchar *) vicColMem;
     chrMem = chr;
@@ -122,6 +124,7 @@ main() {
     /* Use VIC print functions (in this case PETSCII) */
     print = printVicPet;
     printCol = printVicColPet;
+    scrollRect = scrollVicRect;
     init(scr, chr);
     run(scr, chr, vicMem);
     free(vicMem);
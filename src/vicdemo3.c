@@ -282,6 +282,7 @@ main() {
     /* Use optimized horizontal and vertical lines on the VIC */
     drawLineH = drawVicLineH;
     drawLineV = drawVicLineV;
+    drawLineD = drawVicLineD;
     /* VIC aspect ratio */
     aspectRatio = 2;
     init();
@@ -206,6 +206,8 @@ main() {
     uchar border = inp(vicBorderCol);
     uchar background = inp(vicBgCol0);
     scrSize = vicScrSize;
+    scrWidth = vicScrCols;
+    scrHeight = vicScrLines;
     scrMem = scr;
     scrColMem = (uchar *) vicColMem;
     chrMem = chr;
@@ -215,6 +217,7 @@ main() {
     /* Use VIC print functions */
     print = printVicPet;
     printCol = printVicColPet;
+    scrollRect = scrollVicRect;
     init(scr, chr);
     run(scr, chr, vicMem);
     free(vicMem);
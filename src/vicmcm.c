@@ -0,0 +1,181 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe multicolor bitmap functions.
+ *
+ * 160x200 pixels with 2 bits per pixel. Color index 0 is vicBgCol0, 1 is the
+ * upper nibble of screen memory, 2 is the lower nibble of screen memory and 3
+ * is color memory.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <graphics.h>
+#include <vic.h>
+
+/*
+ * Lookup for fast pixel selection.
+ */
+uchar mcmMaskTable[4] = { 0xc0, 0x30, 0x0c, 0x03 };
+
+/*
+ * Lookup for fast horizontal pixel fill from pixel to end of byte.
+ */
+uchar mcmFillTable[5] = { 0xff, 0x3f, 0x0f, 0x03, 0x00 };
+
+/*
+ * Color index 0-3 repeated for all 4 pixels of a byte.
+ */
+uchar mcmColTable[4] = { 0x00, 0x55, 0xaa, 0xff };
+
+/*
+ * Current color index used by set pixel functions.
+ */
+uchar vicMcmColor = 1;
+
+/*
+ * Set multicolor bitmap mode.
+ */
+void setVicMcmBmpMode(uchar mmuRcr, uchar vicBank, uchar scrLoc, uchar bmpLoc) {
+    setVicMmuBank(mmuRcr);
+    setVicBank(vicBank);
+    setVicMode(0, 1, 1);
+    setVicScrMem(scrLoc);
+    setVicBmpMem(bmpLoc);
+}
+
+/*
+ * Set current color index 0-3.
+ */
+void setVicMcmColor(uchar color) {
+    vicMcmColor = color & 0x03;
+}
+
+/*
+ * Set colors of all cells. Background color is shared by all cells.
+ */
+void setVicMcmCol(uchar bg, uchar color1, uchar color2, uchar color3) {
+    uchar c = (color1 << 4) | (color2 & 0x0f);
+    outp(vicBgCol0, bg);
+    fillVicMem(bmpColMem, 0, bmpColSize >> 1, (c << 8) + c);
+    fillVicCol(vicColMem, bmpColSize, color3);
+}
+
+/*
+ * Set colors of 4x8 pixel cell x 0-39, y 0-24.
+ */
+void setVicMcmCell(uchar x, uchar y, uchar color1, uchar color2, uchar color3) {
+    ushort colOfs = (y * 40) + x;
+    bmpColMem[colOfs] = (color1 << 4) | (color2 & 0x0f);
+    outp(vicColMem + colOfs, color3);
+}
+
+/*
+ * Clear bitmap to color index c.
+ */
+void clearVicMcmBmp(uchar c) {
+    c = mcmColTable[c & 0x03];
+    fillVicMem(bmpMem, 0, bmpSize >> 1, (c << 8) + c);
+}
+
+/*
+ * Clear bitmap color memory. Color index 1 and 2 come from c and color index 3
+ * uses the lower nibble of c.
+ */
+void clearVicMcmCol(uchar c) {
+    fillVicMem(bmpColMem, 0, bmpColSize >> 1, (c << 8) + c);
+    fillVicCol(vicColMem, bmpColSize, c);
+}
+
+/*
+ * Set pixel x 0-159, y 0-199 to current color index.
+ */
+void setVicMcmPix(ushort x, ushort y) {
+    ushort pixByte = 40 * (y & 0xf8) + ((x & 0xfc) << 1) + (y & 0x07);
+    uchar mask = mcmMaskTable[x & 0x03];
+    bmpMem[pixByte] = (bmpMem[pixByte] & ~mask)
+            | (mcmColTable[vicMcmColor] & mask);
+}
+
+/*
+ * Clear pixel to background color index 0.
+ */
+void clearVicMcmPix(ushort x, ushort y) {
+    ushort pixByte = 40 * (y & 0xf8) + ((x & 0xfc) << 1) + (y & 0x07);
+    bmpMem[pixByte] = bmpMem[pixByte] & ~(mcmMaskTable[x & 0x03]);
+}
+
+/*
+ * Horizontal line writes whole bytes where the line covers all 4 pixels.
+ */
+void drawVicMcmLineH(ushort x, ushort y, ushort len, uchar setPix) {
+    ushort pixByte = 40 * (y & 0xf8) + ((x & 0xfc) << 1) + (y & 0x07);
+    uchar firstPix = x & 0x03;
+    uchar lastPix = (x + len) & 0x03;
+    uchar color, mask;
+    ushort fillBytes, i;
+    if (setPix) {
+        color = mcmColTable[vicMcmColor];
+    } else {
+        color = 0;
+    }
+    if (firstPix + len < 4) {
+        /* Line starts and ends in same byte */
+        mask = mcmFillTable[firstPix] & ~mcmFillTable[firstPix + len];
+        bmpMem[pixByte] = (bmpMem[pixByte] & ~mask) | (color & mask);
+    } else {
+        if (firstPix > 0) {
+            /* Handle left over pixels on first byte */
+            mask = mcmFillTable[firstPix];
+            bmpMem[pixByte] = (bmpMem[pixByte] & ~mask) | (color & mask);
+            pixByte += 8;
+            len -= 4 - firstPix;
+        }
+        /* Fill in bytes */
+        fillBytes = len >> 2;
+        for (i = 0; i < fillBytes; i++) {
+            bmpMem[pixByte] = color;
+            pixByte += 8;
+        }
+        /* Handle left over pixels on last byte */
+        if (lastPix > 0) {
+            mask = ~mcmFillTable[lastPix];
+            bmpMem[pixByte] = (bmpMem[pixByte] & ~mask) | (color & mask);
+        }
+    }
+}
+
+/*
+ * Vertical line uses less calculation than setVicMcmPix.
+ */
+void drawVicMcmLineV(ushort x, ushort y, ushort len, uchar setPix) {
+    ushort pixByte = 40 * (y & 0xf8) + ((x & 0xfc) << 1) + (y & 0x07);
+    uchar mask = mcmMaskTable[x & 0x03];
+    uchar color, i;
+    if (setPix) {
+        color = mcmColTable[vicMcmColor] & mask;
+    } else {
+        color = 0;
+    }
+    /* Plot pixels */
+    for (i = 0; i < len; i++) {
+        bmpMem[pixByte] = (bmpMem[pixByte] & ~mask) | color;
+        y += 1;
+        /* Increment based on char boundary */
+        if ((y & 7) > 0) {
+            pixByte += 1;
+        } else {
+            pixByte += 313;
+        }
+    }
+}
+
+/*
+ * Fill rectangle with current color index using horizontal lines.
+ */
+void fillVicMcmRect(ushort x, ushort y, ushort w, ushort h) {
+    ushort i;
+    for (i = 0; i < h; i++) {
+        drawVicMcmLineH(x, y + i, w, 1);
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe sprite multiplexer.
+ *
+ * Logical sprites are kept sorted by Y with an insertion sort, which is close
+ * to linear since sprites move little between frames. The first 8 are set in
+ * vertical blank and each hardware sprite is reused once the raster passes the
+ * logical sprite that last used it. A sprite that starts less than 21 lines
+ * below the sprite 8 places before it, or whose hardware sprite is not free
+ * until after line 255, is not shown that frame.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <vic.h>
+
+/*
+ * Logical sprite location, sprite memory pointer and color.
+ */
+ushort vicMuxX[vicMuxSize];
+uchar vicMuxY[vicMuxSize], vicMuxPtr[vicMuxSize], vicMuxCol[vicMuxSize];
+
+/*
+ * Logical sprites sorted by Y.
+ */
+uchar vicMuxOrder[vicMuxSize];
+
+/*
+ * Number of logical sprites.
+ */
+uchar vicMuxCount;
+
+/*
+ * Screen holding sprite memory pointers.
+ */
+uchar *vicMuxScr;
+
+/*
+ * Initialize count logical sprites (up to vicMuxSize) and enable hardware
+ * sprites.
+ */
+void initVicMux(uchar *scr, uchar count) {
+    uchar i;
+    if (count > vicMuxSize) {
+        count = vicMuxSize;
+    }
+    vicMuxScr = scr;
+    vicMuxCount = count;
+    for (i = 0; i < count; i++) {
+        vicMuxOrder[i] = i;
+        vicMuxX[i] = 0;
+        vicMuxY[i] = 0;
+    }
+    if (count > 8) {
+        count = 8;
+    }
+    outp(vicSprEnable, (1 << count) - 1);
+}
+
+/*
+ * Configure logical sprite like configVicSpr.
+ */
+void configVicMux(uchar *spr, uchar sprNum, uchar sprCol) {
+    uchar vicBank = (ushort) vicMuxScr / 16384;
+    vicMuxPtr[sprNum] = ((ushort) spr - (vicBank * 16384)) / 64;
+    vicMuxCol[sprNum] = sprCol;
+}
+
+/*
+ * Set logical sprite location.
+ */
+void setVicMuxLoc(uchar sprNum, ushort x, uchar y) {
+    vicMuxX[sprNum] = x;
+    vicMuxY[sprNum] = y;
+}
+
+/*
+ * Insertion sort logical sprites by Y.
+ */
+void sortVicMux() {
+    uchar i, j, sprNum, y;
+    for (i = 1; i < vicMuxCount; i++) {
+        sprNum = vicMuxOrder[i];
+        y = vicMuxY[sprNum];
+        for (j = i; j > 0 && vicMuxY[vicMuxOrder[j - 1]] > y; j--) {
+            vicMuxOrder[j] = vicMuxOrder[j - 1];
+        }
+        vicMuxOrder[j] = sprNum;
+    }
+}
+
+/*
+ * Set hardware sprite to logical sprite.
+ */
+void setVicMuxSpr(uchar hwNum, uchar sprNum) {
+    ushort x = vicMuxX[sprNum];
+    if (x > 255) {
+        outp(vicSprXmsb, inp(vicSprXmsb) | sprTable[hwNum]);
+    } else {
+        outp(vicSprXmsb, inp(vicSprXmsb) & ~sprTable[hwNum]);
+    }
+    outp(vicSpr0X + (hwNum << 1), x);
+    outp(vicSpr0y + (hwNum << 1), vicMuxY[sprNum]);
+    outp(vicSpr0Col + hwNum, vicMuxCol[sprNum]);
+    vicMuxScr[vicSprMemOfs + hwNum] = vicMuxPtr[sprNum];
+}
+
+/*
+ * Display one frame of logical sprites. Hardware sprite n is reused after the
+ * raster passes the bottom of the logical sprite 8 places before it.
+ */
+void runVicMux() {
+    uchar i;
+    ushort line;
+    sortVicMux();
+    waitVicVBlank();
+    for (i = 0; i < vicMuxCount; i++) {
+        if (i == 8) {
+            /* Wait for top of next frame */
+            while ((inp(vicCtrlReg1) & 0x80) == 0x80)
+                ;
+        }
+        if (i >= 8) {
+            /* Wait for previous user of hardware sprite to finish */
+            line = vicMuxY[vicMuxOrder[i - 8]] + vicSprHeight;
+            /* Skip sprite if hardware sprite is not free in this frame */
+            if (line > 255) {
+                continue;
+            }
+            while (getVicRaster() < line)
+                ;
+        }
+        setVicMuxSpr(i & 0x07, vicMuxOrder[i]);
+    }
+}
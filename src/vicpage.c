@@ -0,0 +1,85 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe page flipping.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <screen.h>
+#include <graphics.h>
+#include <vic.h>
+
+/*
+ * Screen and bitmap memory of each page. Bitmap is 0 for character mode.
+ */
+uchar *vicPageScr[2], *vicPageBmp[2];
+
+/*
+ * Page being displayed.
+ */
+uchar vicFrontPage;
+
+/*
+ * Wait for raster to enter bottom border.
+ */
+void waitVicVBlank() {
+    while ((inp(vicCtrlReg1) & 0x80) == 0x80)
+        ;
+    while ((inp(vicCtrlReg1) & 0x80) != 0x80)
+        ;
+}
+
+/*
+ * Set back page screen and bitmap memory as current screen and bitmap.
+ */
+void setVicBackPage() {
+    uchar back = vicFrontPage ^ 1;
+    scrMem = vicPageScr[back];
+    if (vicPageBmp[back] != 0) {
+        bmpMem = vicPageBmp[back];
+        bmpColMem = vicPageScr[back];
+    }
+}
+
+/*
+ * Display page. VIC bank is set from the screen address, then screen and
+ * bitmap locations are set with one register write.
+ */
+void setVicDspPage(uchar *scr, uchar *bmp) {
+    uchar memCtrl = (((ushort) scr & 0x3fff) / 1024) << 4;
+    if (bmp != 0) {
+        memCtrl |= (((ushort) bmp & 0x3fff) / 8192) << 3;
+    } else {
+        memCtrl |= inp(vicMemCtrl) & 0x0f;
+    }
+    setVicBank((ushort) scr / 16384);
+    outp(vicMemCtrl, memCtrl);
+}
+
+/*
+ * Configure double buffering. Pass 0 for bitmaps in character mode. Character
+ * mode pages can share a VIC bank. A bitmap uses half a bank, so each bitmap
+ * page needs its own bank with its screen in the other half. In banks 0 and 2
+ * the character ROM is seen at 0x1000, so put the bitmap at 0x2000 there. Page
+ * 0 is displayed and drawing is done to page 1.
+ */
+void setVicPages(uchar *scr0, uchar *scr1, uchar *bmp0, uchar *bmp1) {
+    vicPageScr[0] = scr0;
+    vicPageBmp[0] = bmp0;
+    vicPageScr[1] = scr1;
+    vicPageBmp[1] = bmp1;
+    vicFrontPage = 0;
+    setVicDspPage(scr0, bmp0);
+    setVicBackPage();
+}
+
+/*
+ * Display back page during vertical blank and draw to old front page.
+ */
+void flipVicPage() {
+    vicFrontPage ^= 1;
+    waitVicVBlank();
+    setVicDspPage(vicPageScr[vicFrontPage], vicPageBmp[vicFrontPage]);
+    setVicBackPage();
+}
@@ -0,0 +1,154 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe raster timeline.
+ *
+ * A sorted list of raster lines each with register writes compiled ahead of
+ * time, so only port/value pairs are written when the line is reached. Use
+ * runVicRas from a polling loop or call nextVicRas from a raster interrupt.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <vic.h>
+
+/*
+ * Raster line and register writes. Writes are stored as register (low byte of
+ * 0xd0xx port) and value pairs.
+ */
+typedef struct {
+    ushort line;
+    uchar regs;
+    uchar data[vicRasRegs * 2];
+} vicRasEntry;
+
+/*
+ * Timeline sorted by raster line.
+ */
+vicRasEntry vicRas[vicRasSize];
+
+/*
+ * Number of lines and next line to run.
+ */
+uchar vicRasCount = 0, vicRasNext = 0;
+
+/*
+ * Remove all lines.
+ */
+void clearVicRas() {
+    vicRasCount = 0;
+    vicRasNext = 0;
+}
+
+/*
+ * Add raster line 0-255 in sorted order and return its index or vicRasNone if
+ * timeline is full or line is out of range. Indexes of later lines move up one.
+ */
+uchar addVicRas(ushort line) {
+    uchar i;
+    if (vicRasCount == vicRasSize || line > 255) {
+        return vicRasNone;
+    }
+    for (i = vicRasCount; i > 0 && vicRas[i - 1].line > line; i--) {
+        vicRas[i] = vicRas[i - 1];
+    }
+    vicRas[i].line = line;
+    vicRas[i].regs = 0;
+    vicRasCount++;
+    return i;
+}
+
+/*
+ * Add register write to line. Port must be a VIC register (0xd000-0xd0ff).
+ */
+void addVicRasReg(uchar index, ushort port, uchar value) {
+    vicRasEntry *entry = &vicRas[index];
+    if (entry->regs < vicRasRegs) {
+        entry->data[entry->regs << 1] = port;
+        entry->data[(entry->regs << 1) + 1] = value;
+        entry->regs++;
+    }
+}
+
+#ifndef VICASM
+/*
+ * Write count register and value pairs to VIC registers.
+ */
+void outVicRegs(uchar *regs, uchar count) {
+    uchar i;
+    for (i = 0; i < count; i++, regs += 2) {
+        outp(vicSpr0X + regs[0], regs[1]);
+    }
+}
+#endif
+
+/*
+ * Add ecm, bmm and mcm mode writes to line. Other control bits are taken from
+ * the current registers.
+ */
+void setVicRasMode(uchar index, uchar ecm, uchar bmm, uchar mcm) {
+    addVicRasReg(index, vicCtrlReg1,
+            (inp(vicCtrlReg1) & 0x1f) | ((ecm * 0x40) + (bmm * 0x20)));
+    addVicRasReg(index, vicCtrlReg2,
+            (inp(vicCtrlReg2) & 0xef) | (mcm * 0x10));
+}
+
+/*
+ * Add screen and character memory write to line.
+ */
+void setVicRasChrMem(uchar index, uchar scrLoc, uchar chrLoc) {
+    addVicRasReg(index, vicMemCtrl, (scrLoc << 4) | (chrLoc << 1));
+}
+
+/*
+ * Add screen and bitmap memory write to line.
+ */
+void setVicRasBmpMem(uchar index, uchar scrLoc, uchar bmpLoc) {
+    addVicRasReg(index, vicMemCtrl, (scrLoc << 4) | (bmpLoc << 3));
+}
+
+/*
+ * Get 9 bit raster line.
+ */
+ushort getVicRaster() {
+    return ((inp(vicCtrlReg1) & 0x80) << 1) | inp(vicRaster);
+}
+
+/*
+ * Write registers of next line and return raster line of the one after that.
+ * An interrupt handler can call this and set the raster compare to the line
+ * returned. Returns vicRasNoLine if the timeline is empty, so the raster
+ * interrupt should not be armed.
+ */
+ushort nextVicRas() {
+    vicRasEntry *entry = &vicRas[vicRasNext];
+    if (vicRasCount == 0) {
+        return vicRasNoLine;
+    }
+    outVicRegs(entry->data, entry->regs);
+    if (++vicRasNext == vicRasCount) {
+        vicRasNext = 0;
+    }
+    return vicRas[vicRasNext].line;
+}
+
+/*
+ * Run timeline for one frame by polling the raster register.
+ */
+void runVicRas() {
+    uchar i;
+    ushort line;
+    if (vicRasCount > 0) {
+        waitVicVBlank();
+        /* Wait for top of next frame */
+        while ((inp(vicCtrlReg1) & 0x80) == 0x80)
+            ;
+        vicRasNext = 0;
+        for (i = 0; i < vicRasCount; i++) {
+            line = vicRas[i].line;
+            while (inp(vicRaster) < line)
+                ;
+            nextVicRas();
+        }
+    }
+}
@@ -48,34 +48,28 @@ void clearVicScr(uchar c) {
  * Clear color memory.
  */
 void clearVicCol(uchar c) {
-    register ushort i;
-    for (i = 0; i < scrSize; i++) {
-        outp((ushort) scrColMem + i, c);
-    }
+    fillVicCol((ushort) scrColMem, scrSize, c);
 }
 
+#ifndef VICASM
 /*
  * Print without color.
  */
 void printVic(uchar x, uchar y, char *str) {
-    ushort scrOfs = (y * 40) + x;
+    ushort scrOfs = (y * scrWidth) + x;
     ushort len = strlen(str);
     ushort i;
     for (i = 0; i < len; i++) {
         scrMem[scrOfs + i] = str[i];
     }
 }
+#endif
 
 /*
  * Print with color.
  */
 void printVicCol(uchar x, uchar y, uchar color, char *str) {
-    ushort colOfs = (ushort) scrColMem + (y * 40) + x;
-    ushort len = strlen(str);
-    ushort i;
-    for (i = 0; i < len; i++) {
-        outp(colOfs + i, color);
-    }
+    fillVicCol((ushort) scrColMem + (y * scrWidth) + x, strlen(str), color);
     printVic(x, y, str);
 }
 
@@ -97,6 +91,7 @@ void printVicColPet(uchar x, uchar y, uchar color, char *str) {
     free(petStr);
 }
 
+#ifndef VICASM
 /*
  * Scroll screen memory up 1 line starting at x for len words.
  */
@@ -104,22 +99,115 @@ void scrollVicUpX(uchar *scr, uchar x, uchar y, uchar len, uchar lines) {
     register uchar w;
     uchar i;
     ushort *scr16 = (ushort *) scr;
-    ushort destLine = (y * 20) + x;
-    ushort sourceLine = destLine + 20;
+    uchar lineWords = scrWidth >> 1;
+    ushort destLine = (y * lineWords) + x;
+    ushort sourceLine = destLine + lineWords;
     for (i = 0; i < lines; i++) {
         for (w = 0; w < len; w++) {
             scr16[destLine + w] = scr16[sourceLine + w];
         }
-        destLine += 20;
-        sourceLine = destLine + 20;
+        destLine += lineWords;
+        sourceLine = destLine + lineWords;
     }
 }
+#endif
 
 /*
  * Scroll screen memory up 1 line by number of lines.
  */
 void scrollVicUp(uchar *scr, uchar y, uchar lines) {
-    scrollVicUpX(scr, 0, y, 20, lines);
+    scrollVicUpX(scr, 0, y, scrWidth >> 1, lines);
+}
+
+/*
+ * Scroll color memory up 1 line starting at x for len bytes.
+ */
+void scrollVicColUpX(uchar x, uchar y, uchar len, uchar lines) {
+    uchar i;
+    ushort destLine = (ushort) scrColMem + (y * scrWidth) + x;
+    for (i = 0; i < lines; i++) {
+        copyVicCol(destLine + scrWidth, destLine, len);
+        destLine += scrWidth;
+    }
+}
+
+/*
+ * Scroll color memory down 1 line starting at x for len bytes. y is the top
+ * line of the region and line y + lines receives line y + lines - 1.
+ */
+void scrollVicColDownX(uchar x, uchar y, uchar len, uchar lines) {
+    uchar i;
+    ushort sourceLine = (ushort) scrColMem + ((y + lines - 1) * scrWidth) + x;
+    for (i = 0; i < lines; i++) {
+        copyVicCol(sourceLine, sourceLine + scrWidth, len);
+        sourceLine -= scrWidth;
+    }
+}
+
+/*
+ * Scroll w x h rectangle at x, y 1 character in direction dir (scrUp, scrDown,
+ * scrLeft or scrRight). Or in scrCol to move color memory too and scrFill to
+ * fill the vacated line or column with c (and color if scrCol is set).
+ */
+void scrollVicRect(uchar x, uchar y, uchar w, uchar h, uchar dir, uchar c,
+        uchar color) {
+    uchar *rowMem = &scrMem[(y * scrWidth) + x];
+    ushort colMem = (ushort) scrColMem + (y * scrWidth) + x;
+    int step = scrWidth;
+    uchar line[vicScrCols];
+    uchar i;
+    if ((dir & 0x0f) == scrUp || (dir & 0x0f) == scrDown) {
+        /* Scroll down from bottom line */
+        if ((dir & 0x0f) == scrDown) {
+            rowMem += (h - 1) * scrWidth;
+            colMem += (h - 1) * scrWidth;
+            step = -step;
+        }
+        for (i = 1; i < h; i++) {
+            memcpy(rowMem, rowMem + step, w);
+            if (dir & scrCol) {
+                copyVicCol(colMem + step, colMem, w);
+            }
+            rowMem += step;
+            colMem += step;
+        }
+        if (dir & scrFill) {
+            memset(rowMem, c, w);
+            if (dir & scrCol) {
+                fillVicCol(colMem, w, color);
+            }
+        }
+    } else {
+        for (i = 0; i < h; i++) {
+            if ((dir & 0x0f) == scrLeft) {
+                memmove(rowMem, rowMem + 1, w - 1);
+                if (dir & scrCol) {
+                    readVicCol(colMem + 1, line, w - 1);
+                    writeVicCol(colMem, line, w - 1);
+                }
+                if (dir & scrFill) {
+                    rowMem[w - 1] = c;
+                    if (dir & scrCol) {
+                        outp(colMem + w - 1, color);
+                    }
+                }
+            } else {
+                memmove(rowMem + 1, rowMem, w - 1);
+                if (dir & scrCol) {
+                    readVicCol(colMem, line, w - 1);
+                    writeVicCol(colMem + 1, line, w - 1);
+                }
+                if (dir & scrFill) {
+                    rowMem[0] = c;
+                    if (dir & scrCol) {
+                        outp(colMem, color);
+                    }
+                }
+            }
+            rowMem += scrWidth;
+            colMem += scrWidth;
+        }
+    }
 }
 
 /*
@@ -130,7 +218,7 @@ char *readVicLine(uchar *scr, uchar x, uchar y, uchar len) {
     uchar strLen;
     char *str;
     uchar keyVal, lastKeyVal, i;
-    ushort scrOfs = (y * 40) + x;
+    ushort scrOfs = (y * scrWidth) + x;
     ushort scrMin = scrOfs;
     ushort scrMax = scrMin + len - 1;
     lastKeyVal = 0x00;
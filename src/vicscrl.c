@@ -0,0 +1,177 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe smooth scrolling functions.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <string.h>
+#include <sys.h>
+#include <hitech.h>
+#include <screen.h>
+#include <vic.h>
+
+/*
+ * Screens and their 1K screen locations.
+ */
+uchar *vicSmoothScr[2];
+uchar vicSmoothLoc[2];
+
+/*
+ * Displayed screen, direction, fine scroll, next chunk and fill character.
+ */
+uchar vicSmoothFront, vicSmoothDir, vicSmoothFine, vicSmoothChunk,
+        vicSmoothFill;
+
+/*
+ * Called with the vacated line or column of the back screen before it is
+ * displayed, so new content can scroll in. edge is the first character, step
+ * is the distance to the next character and len is the number of characters.
+ * Set to NULL to only use the fill character.
+ */
+void (*vicSmoothEdge)(uchar *edge, uchar step, uchar len);
+
+/*
+ * Call edge function with vacated line or column of back screen.
+ */
+void edgeVicSmooth(uchar *back) {
+    if (vicSmoothDir == scrUp) {
+        (*vicSmoothEdge)(back + (scrHeight - 1) * scrWidth, 1, scrWidth);
+    } else if (vicSmoothDir == scrDown) {
+        (*vicSmoothEdge)(back, 1, scrWidth);
+    } else if (vicSmoothDir == scrLeft) {
+        (*vicSmoothEdge)(back + scrWidth - 1, scrWidth, scrHeight);
+    } else {
+        (*vicSmoothEdge)(back, scrWidth, scrHeight);
+    }
+}
+
+/*
+ * Set fine scroll for direction. Vertical scroll uses vicCtrlReg1 and
+ * horizontal scroll uses vicCtrlReg2.
+ */
+void setVicFineScroll(uchar dir, uchar fine) {
+    if (dir == scrUp || dir == scrDown) {
+        outp(vicCtrlReg1, (inp(vicCtrlReg1) & 0x78) | fine);
+    } else {
+        outp(vicCtrlReg2, (inp(vicCtrlReg2) & 0xf8) | fine);
+    }
+}
+
+/*
+ * Copy next eighth of the front screen to the back screen shifted one
+ * character in scroll direction. Vacated line or column is filled.
+ */
+void prepVicSmooth() {
+    uchar *front = vicSmoothScr[vicSmoothFront];
+    uchar *back = vicSmoothScr[vicSmoothFront ^ 1];
+    uchar lines = (scrHeight + 7) >> 3;
+    uchar first = vicSmoothChunk * lines;
+    uchar last = first + lines;
+    uchar y;
+    ushort lineOfs;
+    if (vicSmoothChunk == 0) {
+        /* Keep sprite pointers the same */
+        memcpy(back + vicSprMemOfs, front + vicSprMemOfs, 8);
+    }
+    if (last > scrHeight) {
+        last = scrHeight;
+    }
+    lineOfs = first * scrWidth;
+    for (y = first; y < last; y++) {
+        if (vicSmoothDir == scrUp) {
+            if (y < scrHeight - 1) {
+                memcpy(back + lineOfs, front + lineOfs + scrWidth, scrWidth);
+            } else {
+                memset(back + lineOfs, vicSmoothFill, scrWidth);
+            }
+        } else if (vicSmoothDir == scrDown) {
+            if (y > 0) {
+                memcpy(back + lineOfs, front + lineOfs - scrWidth, scrWidth);
+            } else {
+                memset(back + lineOfs, vicSmoothFill, scrWidth);
+            }
+        } else if (vicSmoothDir == scrLeft) {
+            memcpy(back + lineOfs, front + lineOfs + 1, scrWidth - 1);
+            back[lineOfs + scrWidth - 1] = vicSmoothFill;
+        } else {
+            memcpy(back + lineOfs + 1, front + lineOfs, scrWidth - 1);
+            back[lineOfs] = vicSmoothFill;
+        }
+        lineOfs += scrWidth;
+    }
+    vicSmoothChunk++;
+    /* Back screen is complete, so let caller fill in the new edge */
+    if (vicSmoothChunk == 8 && vicSmoothEdge != NULL) {
+        edgeVicSmooth(back);
+    }
+}
+
+/*
+ * Start smooth scrolling in direction dir (scrUp, scrDown, scrLeft or
+ * scrRight) using two screens in the current VIC bank. Vacated line or column
+ * is filled with c and then passed to vicSmoothEdge if set. scrMem always
+ * points to the displayed screen. The coarse shift is copied to the back screen
+ * an eighth at a time while fine scrolling and swapped in when fine scroll
+ * wraps. Color memory is not moved.
+ */
+void initVicSmooth(uchar *scr0, uchar *scr1, uchar dir, uchar c) {
+    uchar vicBank = (ushort) scr0 / 16384;
+    vicSmoothScr[0] = scr0;
+    vicSmoothScr[1] = scr1;
+    vicSmoothLoc[0] = ((ushort) scr0 - (vicBank * 16384)) / 1024;
+    vicSmoothLoc[1] = ((ushort) scr1 - (vicBank * 16384)) / 1024;
+    vicSmoothFront = 0;
+    vicSmoothDir = dir;
+    vicSmoothFill = c;
+    vicSmoothChunk = 0;
+    scrMem = scr0;
+    setVicScrMem(vicSmoothLoc[0]);
+    /* 24 rows and 38 columns hide the edge being scrolled in */
+    outp(vicCtrlReg1, inp(vicCtrlReg1) & 0xf7);
+    outp(vicCtrlReg2, inp(vicCtrlReg2) & 0xf7);
+    if (dir == scrUp || dir == scrLeft) {
+        vicSmoothFine = 7;
+    } else {
+        vicSmoothFine = 0;
+    }
+    setVicFineScroll(dir, vicSmoothFine);
+}
+
+/*
+ * Scroll one pixel. Call once per frame. Waits for the raster to reach the
+ * bottom border, sets fine scroll (swapping screens at a character boundary)
+ * and copies the next eighth of the coarse shift.
+ */
+void scrollVicSmooth() {
+    uchar wrap;
+    waitVicVBlank();
+    if (vicSmoothDir == scrUp || vicSmoothDir == scrLeft) {
+        wrap = (vicSmoothFine == 0);
+        vicSmoothFine = (vicSmoothFine - 1) & 0x07;
+    } else {
+        wrap = (vicSmoothFine == 7);
+        vicSmoothFine = (vicSmoothFine + 1) & 0x07;
+    }
+    if (wrap) {
+        /* Finish any copying left, then show shifted screen */
+        while (vicSmoothChunk < 8)
+            prepVicSmooth();
+        vicSmoothFront ^= 1;
+        setVicScrMem(vicSmoothLoc[vicSmoothFront]);
+        scrMem = vicSmoothScr[vicSmoothFront];
+        vicSmoothChunk = 0;
+    }
+    setVicFineScroll(vicSmoothDir, vicSmoothFine);
+    if (vicSmoothChunk < 8) {
+        prepVicSmooth();
+    }
+}
+
+/*
+ * Stop smooth scrolling and restore 25 rows, 40 columns and default fine
+ * scroll.
+ */
+void doneVicSmooth() {
+    outp(vicCtrlReg1, (inp(vicCtrlReg1) & 0x70) | 0x0b);
+    outp(vicCtrlReg2, (inp(vicCtrlReg2) & 0xf0) | 0x08);
+}
@@ -0,0 +1,107 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe sprite sheet and animation functions.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <string.h>
+#include <hitech.h>
+#include <vic.h>
+
+/*
+ * Animation sequence of a hardware sprite.
+ */
+typedef struct {
+    uchar first;
+    uchar frames;
+    uchar ticks;
+    uchar frame;
+    uchar count;
+} vicSprAnim;
+
+/*
+ * Animation of each hardware sprite.
+ */
+vicSprAnim vicAnim[8];
+
+/*
+ * Sprite memory pointer of first slot, number of slots and next free slot.
+ */
+uchar vicSheetPtr, vicSheetSlots, vicSheetNext;
+
+/*
+ * Sprite sheet memory.
+ */
+uchar *vicSheetMem;
+
+/*
+ * Use slots 64 byte slots starting at 64 byte aligned sheet in the current VIC
+ * bank. Animations are stopped.
+ */
+void initVicSheet(uchar *sheet, uchar slots) {
+    uchar vicBank = (ushort) sheet / 16384;
+    uchar i;
+    vicSheetMem = sheet;
+    vicSheetPtr = ((ushort) sheet - (vicBank * 16384)) / 64;
+    vicSheetSlots = slots;
+    vicSheetNext = 0;
+    for (i = 0; i < 8; i++) {
+        vicAnim[i].frames = 0;
+    }
+}
+
+/*
+ * Copy frames of 63 byte sprite data to next free slots. Returns first slot or
+ * vicSheetNone if sheet is full.
+ */
+uchar addVicSheet(uchar *spr, uchar frames) {
+    uchar slot = vicSheetNext, i;
+    if (vicSheetSlots - vicSheetNext < frames) {
+        return vicSheetNone;
+    }
+    for (i = 0; i < frames; i++) {
+        memcpy(&vicSheetMem[(slot + i) << 6], &spr[i * 63], 63);
+    }
+    vicSheetNext += frames;
+    return slot;
+}
+
+/*
+ * Show slot on sprite.
+ */
+void setVicSheetSpr(uchar *scr, uchar sprNum, uchar slot) {
+    vicAnim[sprNum].frames = 0;
+    scr[vicSprMemOfs + sprNum] = vicSheetPtr + slot;
+}
+
+/*
+ * Animate sprite with frames starting at slot. Frame changes every ticks calls
+ * to tickVicSheet.
+ */
+void setVicSheetAnim(uchar *scr, uchar sprNum, uchar slot, uchar frames,
+        uchar ticks) {
+    vicSprAnim *anim = &vicAnim[sprNum];
+    anim->first = vicSheetPtr + slot;
+    anim->frames = frames;
+    anim->ticks = ticks;
+    anim->frame = 0;
+    anim->count = 0;
+    scr[vicSprMemOfs + sprNum] = anim->first;
+}
+
+/*
+ * Advance animations. Only the sprite memory pointer is written.
+ */
+void tickVicSheet(uchar *scr) {
+    vicSprAnim *anim = vicAnim;
+    uchar i;
+    for (i = 0; i < 8; i++, anim++) {
+        if (anim->frames > 0 && ++anim->count == anim->ticks) {
+            anim->count = 0;
+            if (++anim->frame == anim->frames) {
+                anim->frame = 0;
+            }
+            scr[vicSprMemOfs + i] = anim->first + anim->frame;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe shadow sprite register functions.
+ *
+ * Sprite registers 0xd000-0xd02e are kept in memory and only registers that
+ * changed are written by flushVicSpr once per frame.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <hitech.h>
+#include <vic.h>
+
+/*
+ * Shadow registers and dirty bit for each register.
+ */
+uchar vicSprSh[vicSprShSize];
+uchar vicSprDirty[(vicSprShSize + 7) >> 3];
+
+/*
+ * Bit set for each sprite register. Control, raster, light pen, interrupt,
+ * collision and border/background registers are not shadowed. Collision
+ * registers clear on read, see latchVicColl.
+ */
+uchar vicSprShRegs[(vicSprShSize + 7) >> 3] = { 0xff, 0xff, 0xa1, 0x38, 0xe0,
+        0x7f };
+
+/*
+ * Load shadow registers from sprite registers.
+ */
+void initVicShSpr() {
+    uchar i;
+    for (i = 0; i < vicSprShSize; i++) {
+        if ((vicSprShRegs[i >> 3] & sprTable[i & 0x07]) != 0) {
+            vicSprSh[i] = inp(vicSpr0X + i);
+        }
+    }
+    for (i = 0; i < sizeof(vicSprDirty); i++) {
+        vicSprDirty[i] = 0;
+    }
+}
+
+/*
+ * Set shadow register 0-46 and mark dirty if value changed. Registers that are
+ * not sprite registers are ignored.
+ */
+void putVicShSpr(uchar reg, uchar value) {
+    if ((vicSprShRegs[reg >> 3] & sprTable[reg & 0x07]) != 0
+            && vicSprSh[reg] != value) {
+        vicSprSh[reg] = value;
+        vicSprDirty[reg >> 3] |= sprTable[reg & 0x07];
+    }
+}
+
+/*
+ * Set sprite location.
+ */
+void setVicShSprLoc(uchar sprNum, ushort x, uchar y) {
+    uchar xMsb = vicSprSh[vicSprXmsb - vicSpr0X];
+    if (x > 255) {
+        putVicShSpr(vicSprXmsb - vicSpr0X, xMsb | sprTable[sprNum]);
+    } else {
+        putVicShSpr(vicSprXmsb - vicSpr0X, xMsb & ~sprTable[sprNum]);
+    }
+    putVicShSpr(sprNum << 1, x);
+    putVicShSpr((sprNum << 1) + 1, y);
+}
+
+/*
+ * Enable sprite.
+ */
+void enableVicShSpr(uchar sprNum) {
+    putVicShSpr(vicSprEnable - vicSpr0X,
+            vicSprSh[vicSprEnable - vicSpr0X] | sprTable[sprNum]);
+}
+
+/*
+ * Disable sprite.
+ */
+void disableVicShSpr(uchar sprNum) {
+    putVicShSpr(vicSprEnable - vicSpr0X,
+            vicSprSh[vicSprEnable - vicSpr0X] & ~sprTable[sprNum]);
+}
+
+/*
+ * Make sprite appear in foreground.
+ */
+void setVicShSprFg(uchar sprNum) {
+    putVicShSpr(vicSprFg - vicSpr0X,
+            vicSprSh[vicSprFg - vicSpr0X] & ~sprTable[sprNum]);
+}
+
+/*
+ * Make sprite appear in background.
+ */
+void setVicShSprBg(uchar sprNum) {
+    putVicShSpr(vicSprFg - vicSpr0X,
+            vicSprSh[vicSprFg - vicSpr0X] | sprTable[sprNum]);
+}
+
+/*
+ * Set sprite color.
+ */
+void setVicShSprCol(uchar sprNum, uchar sprCol) {
+    putVicShSpr(vicSpr0Col - vicSpr0X + sprNum, sprCol);
+}
+
+/*
+ * Wait for vertical blank and write changed registers.
+ */
+void flushVicSpr() {
+    uchar i, b, dirty, reg;
+    waitVicVBlank();
+    for (i = 0; i < sizeof(vicSprDirty); i++) {
+        dirty = vicSprDirty[i];
+        if (dirty != 0) {
+            reg = i << 3;
+            for (b = 0; b < 8; b++) {
+                if ((dirty & sprTable[b]) != 0) {
+                    outp(vicSpr0X + reg + b, vicSprSh[reg + b]);
+                }
+            }
+            vicSprDirty[i] = 0;
+        }
+    }
+}
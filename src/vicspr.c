@@ -71,3 +71,34 @@ void setVicSprBg(uchar sprNum) {
     /* Sprite priority */
     outp(vicSprFg, inp(vicSprFg) | sprTable[sprNum]);
 }
+
+/*
+ * Enable sprite multicolor mode.
+ */
+void enableVicSprMcm(uchar sprNum) {
+    outp(vicSprMcm, inp(vicSprMcm) | sprTable[sprNum]);
+}
+
+/*
+ * Disable sprite multicolor mode.
+ */
+void disableVicSprMcm(uchar sprNum) {
+    outp(vicSprMcm, inp(vicSprMcm) & ~sprTable[sprNum]);
+}
+
+/*
+ * Set sprite multicolors shared by all multicolor sprites.
+ */
+void setVicSprMcmCol(uchar color0, uchar color1) {
+    outp(vicSprMcmCol0, color0);
+    outp(vicSprMcmCol1, color1);
+}
+
+/*
+ * Set sprite X and Y expansion to 0 (off) or 1 (on).
+ */
+void setVicSprExp(uchar sprNum, uchar xExp, uchar yExp) {
+    uchar bit = sprTable[sprNum];
+    outp(vicSprXexp, (inp(vicSprXexp) & ~bit) | (xExp * bit));
+    outp(vicSprYexp, (inp(vicSprYexp) & ~bit) | (yExp * bit));
+}
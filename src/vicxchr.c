@@ -0,0 +1,94 @@
+/*
+ * C128 CP/M 8564/8566 VIC-IIe extended background color (ECM) and multicolor
+ * character mode functions.
+ *
+ * Copyright (c) Steven P. Goldsmith. All rights reserved.
+ */
+
+#include <sys.h>
+#include <string.h>
+#include <hitech.h>
+#include <screen.h>
+#include <vic.h>
+
+/*
+ * Set extended background color character mode. Only the first 64 characters
+ * of the character set are used and the upper 2 bits of each screen code
+ * select background color register 0-3.
+ */
+void setVicEcmMode(uchar mmuRcr, uchar vicBank, uchar scrLoc, uchar chrLoc) {
+    setVicMmuBank(mmuRcr);
+    setVicBank(vicBank);
+    setVicMode(1, 0, 0);
+    setVicScrMem(scrLoc);
+    setVicChrMem(chrLoc);
+}
+
+/*
+ * Set multicolor character mode. Characters with color 8-15 are 4x8 multicolor
+ * using background color registers 0-2 and color 0-7 of color memory.
+ */
+void setVicMcmChrMode(uchar mmuRcr, uchar vicBank, uchar scrLoc, uchar chrLoc) {
+    setVicMmuBank(mmuRcr);
+    setVicBank(vicBank);
+    setVicMode(0, 0, 1);
+    setVicScrMem(scrLoc);
+    setVicChrMem(chrLoc);
+}
+
+/*
+ * Set background color registers 0-3.
+ */
+void setVicBgCols(uchar bg0, uchar bg1, uchar bg2, uchar bg3) {
+    outp(vicBgCol0, bg0);
+    outp(vicBgCol1, bg1);
+    outp(vicBgCol2, bg2);
+    outp(vicBgCol3, bg3);
+}
+
+/*
+ * Build 64 character ECM set from 256 character ASCII set. ASCII 64-95 go to
+ * 0-31 and ASCII 32-63 go to 32-63, the same layout as the ROM character set,
+ * so ASCII maps to ECM with c & 0x3f.
+ */
+void copyVicEcmChr(uchar *srcChr, uchar *destChr) {
+    uchar i;
+    for (i = 0; i < 32; i++) {
+        memcpy(&destChr[i << 3], &srcChr[(i + 64) << 3], 8);
+    }
+    memcpy(&destChr[32 << 3], &srcChr[32 << 3], 32 << 3);
+}
+
+/*
+ * Print ASCII using background color register 0-3. Lower case is printed as
+ * upper case.
+ */
+void printVicEcm(uchar x, uchar y, uchar bg, char *str) {
+    ushort scrOfs = (y * scrWidth) + x;
+    ushort len = strlen(str);
+    uchar bgBits = bg << 6;
+    ushort i;
+    uchar c;
+    for (i = 0; i < len; i++) {
+        c = str[i];
+        if (c >= 'a' && c <= 'z') {
+            c -= 32;
+        }
+        scrMem[scrOfs + i] = (c & 0x3f) | bgBits;
+    }
+}
+
+/*
+ * Print ASCII with color using background color register 0-3.
+ */
+void printVicEcmCol(uchar x, uchar y, uchar color, uchar bg, char *str) {
+    fillVicCol((ushort) scrColMem + (y * scrWidth) + x, strlen(str), color);
+    printVicEcm(x, y, bg, str);
+}
+
+/*
+ * Print multicolor characters using color 0-7 of color memory.
+ */
+void printVicMcmCol(uchar x, uchar y, uchar color, char *str) {
+    printVicCol(x, y, color | 0x08, str);
+}